@@ -315,7 +315,7 @@ static void RCTSendScrollEventForNativeAnimations_DEPRECATED(UIScrollView *scrol
   _state = std::static_pointer_cast<ScrollViewShadowNode::ConcreteState const>(state);
   auto &data = _state->getData();
 
-  auto contentOffset = RCTCGPointFromPoint(data.contentOffset);
+  auto contentOffset = RCTCGPointFromPoint(data.getContentOffset());
   if (!oldState && !CGPointEqualToPoint(contentOffset, CGPointZero)) {
     _scrollView.contentOffset = contentOffset;
   }
@@ -411,6 +411,13 @@ static void RCTSendScrollEventForNativeAnimations_DEPRECATED(UIScrollView *scrol
     return;
   }
   auto contentOffset = RCTPointFromCGPoint(_scrollView.contentOffset);
+  const auto &latestContentOffset = _state->getData().latestContentOffset;
+  if (latestContentOffset) {
+    // Layout does not depend on the content offset, so there is nothing to
+    // commit; readers like `measure` pick the published value up directly.
+    latestContentOffset->set(contentOffset);
+    return;
+  }
   _state->updateState([contentOffset](const ScrollViewShadowNode::ConcreteState::Data &data) {
     auto newData = data;
     newData.contentOffset = contentOffset;
@@ -463,6 +470,9 @@ static void RCTSendScrollEventForNativeAnimations_DEPRECATED(UIScrollView *scrol
 
 - (void)scrollViewDidScroll:(UIScrollView *)scrollView
 {
+  // While the user scrolls, the offset is published once the gesture ends
+  // unless granular updates are enabled. Publishing does not commit either
+  // way.
   if (!_isUserTriggeredScrolling || CoreFeatures::enableGranularScrollViewStateUpdatesIOS) {
     [self _updateStateWithContentOffset];
   }
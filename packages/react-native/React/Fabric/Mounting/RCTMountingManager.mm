@@ -107,6 +107,18 @@ static void RCTPerformMountInstructions(
         break;
       }
 
+      case ShadowViewMutation::Move: {
+        // Only generated when `PlatformSupportsMoveInstruction` is enabled,
+        // which it is not on iOS yet: the view is unmounted and mounted again.
+        auto &childShadowView = mutation.newChildShadowView;
+        auto &parentShadowView = mutation.parentShadowView;
+        auto &childViewDescriptor = [registry componentViewDescriptorWithTag:childShadowView.tag];
+        auto &parentViewDescriptor = [registry componentViewDescriptorWithTag:parentShadowView.tag];
+        [parentViewDescriptor.view unmountChildComponentView:childViewDescriptor.view index:mutation.fromIndex];
+        [parentViewDescriptor.view mountChildComponentView:childViewDescriptor.view index:mutation.index];
+        break;
+      }
+
       case ShadowViewMutation::Update: {
         auto &oldChildShadowView = mutation.oldChildShadowView;
         auto &newChildShadowView = mutation.newChildShadowView;
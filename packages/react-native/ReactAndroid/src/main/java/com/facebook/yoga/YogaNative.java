@@ -9,6 +9,7 @@ package com.facebook.yoga;
 
 import com.facebook.yoga.annotations.DoNotStrip;
 import com.facebook.soloader.SoLoader;
+import java.nio.ByteBuffer;
 
 @DoNotStrip
 public class YogaNative {
@@ -39,6 +40,8 @@ public class YogaNative {
   static native void jni_YGNodeRemoveAllChildrenJNI(long nativePointer);
   static native void jni_YGNodeRemoveChildJNI(long nativePointer, long childPointer);
   static native void jni_YGNodeCalculateLayoutJNI(long nativePointer, float width, float height, long[] nativePointers, YogaNodeJNIBase[] nodes);
+  static native int jni_YGNodeCalculateLayoutToBufferJNI(long nativePointer, float width, float height, long[] nativePointers, YogaNodeJNIBase[] nodes, ByteBuffer layoutBuffer);
+  static native int jni_YGNodeTransferLayoutToBufferJNI(long nativePointer, long[] nativePointers, ByteBuffer layoutBuffer);
   static native void jni_YGNodeMarkDirtyJNI(long nativePointer);
   static native boolean jni_YGNodeIsDirtyJNI(long nativePointer);
   static native void jni_YGNodeCopyStyleJNI(long dstNativePointer, long srcNativePointer);
@@ -111,6 +114,7 @@ public class YogaNative {
   static native void jni_YGNodeSetHasMeasureFuncJNI(long nativePointer, boolean hasMeasureFunc);
   static native void jni_YGNodeSetHasBaselineFuncJNI(long nativePointer, boolean hasMeasureFunc);
   static native void jni_YGNodeSetStyleInputsJNI(long nativePointer, float[] styleInputsArray, int size);
+  static native void jni_YGNodeSetStyleInputsForNodesJNI(long[] nativePointers, ByteBuffer styleInputs, int size);
   static native long jni_YGNodeCloneJNI(long nativePointer);
   static native void jni_YGNodeSetAlwaysFormsContainingBlockJNI(long nativePointer, boolean alwaysFormContainingBlock);
 }
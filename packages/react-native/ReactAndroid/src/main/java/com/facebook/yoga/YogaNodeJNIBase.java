@@ -8,6 +8,9 @@
 package com.facebook.yoga;
 
 import com.facebook.yoga.annotations.DoNotStrip;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.FloatBuffer;
 import java.util.ArrayList;
 import java.util.List;
 import javax.annotation.Nullable;
@@ -30,6 +33,9 @@ public abstract class YogaNodeJNIBase extends YogaNode implements Cloneable {
   private static final byte LAYOUT_MARGIN_START_INDEX = 6;
   private static final byte LAYOUT_PADDING_START_INDEX = 10;
   private static final byte LAYOUT_BORDER_START_INDEX = 14;
+  private static final byte LAYOUT_MAX_SIZE = 18;
+  /* A packed layout record is the node index followed by the arr values. */
+  private static final byte LAYOUT_RECORD_MAX_SIZE = LAYOUT_MAX_SIZE + 1;
 
   @Nullable private YogaNodeJNIBase mOwner;
   @Nullable private List<YogaNodeJNIBase> mChildren;
@@ -44,6 +50,9 @@ public abstract class YogaNodeJNIBase extends YogaNode implements Cloneable {
 
   private boolean mHasNewLayout = true;
 
+  /* Reused across layout passes when this node is the root of calculateLayout */
+  @Nullable private ByteBuffer mLayoutBuffer;
+
   private YogaNodeJNIBase(long nativePointer) {
     if (nativePointer == 0) {
       throw new IllegalStateException("Failed to allocate native memory");
@@ -66,6 +75,7 @@ public abstract class YogaNodeJNIBase extends YogaNode implements Cloneable {
     arr = null;
     mHasNewLayout = true;
     mLayoutDirection = 0;
+    mLayoutBuffer = null;
 
     YogaNative.jni_YGNodeResetJNI(mNativePointer);
   }
@@ -217,7 +227,60 @@ public abstract class YogaNodeJNIBase extends YogaNode implements Cloneable {
       nativePointers[i] = nodes[i].mNativePointer;
     }
 
-    YogaNative.jni_YGNodeCalculateLayoutJNI(mNativePointer, width, height, nativePointers, nodes);
+    // Every node's layout comes back in a single buffer, so a layout pass costs
+    // one JNI transition instead of one per node.
+    final int capacity = nodes.length * LAYOUT_RECORD_MAX_SIZE * 4;
+    if (mLayoutBuffer == null || mLayoutBuffer.capacity() < capacity) {
+      mLayoutBuffer = ByteBuffer.allocateDirect(capacity).order(ByteOrder.nativeOrder());
+    }
+    int size =
+        YogaNative.jni_YGNodeCalculateLayoutToBufferJNI(
+            mNativePointer, width, height, nativePointers, nodes, mLayoutBuffer);
+    if (size * 4 > mLayoutBuffer.capacity()) {
+      // Nothing was written, and the layout is still marked as new.
+      mLayoutBuffer = ByteBuffer.allocateDirect(size * 4).order(ByteOrder.nativeOrder());
+      size =
+          YogaNative.jni_YGNodeTransferLayoutToBufferJNI(
+              mNativePointer, nativePointers, mLayoutBuffer);
+    }
+    readLayoutOutputs(nodes, mLayoutBuffer.asFloatBuffer(), size);
+  }
+
+  /* Mirrors packLayoutOutputs in YGBulkTransfer.h */
+  private static void readLayoutOutputs(YogaNodeJNIBase[] nodes, FloatBuffer layout, int size) {
+    while (layout.position() < size) {
+      final YogaNodeJNIBase node = nodes[(int) layout.get()];
+      final int flags = (int) layout.get();
+      final int arrSize =
+          6
+              + ((flags & MARGIN) == MARGIN ? 4 : 0)
+              + ((flags & PADDING) == PADDING ? 4 : 0)
+              + ((flags & BORDER) == BORDER ? 4 : 0);
+      node.arr = new float[arrSize];
+      node.arr[LAYOUT_EDGE_SET_FLAG_INDEX] = flags;
+      layout.get(node.arr, LAYOUT_WIDTH_INDEX, arrSize - 1);
+    }
+  }
+
+  /**
+   * Applies a packed sequence of style inputs (see {@link YogaStyleInputs}) with a single JNI
+   * call. Each input is its key followed by its arguments.
+   */
+  public void setStyleInputs(float[] styleInputs, int size) {
+    YogaNative.jni_YGNodeSetStyleInputsJNI(mNativePointer, styleInputs, size);
+  }
+
+  /**
+   * Applies style inputs to many nodes with a single JNI call. styleInputs must be a direct buffer
+   * in native byte order holding, for each node in order, the number of floats that follow for
+   * that node and then its style inputs. size is the number of floats in the buffer.
+   */
+  public static void setStyleInputs(YogaNodeJNIBase[] nodes, ByteBuffer styleInputs, int size) {
+    long[] nativePointers = new long[nodes.length];
+    for (int i = 0; i < nodes.length; ++i) {
+      nativePointers[i] = nodes[i].mNativePointer;
+    }
+    YogaNative.jni_YGNodeSetStyleInputsForNodesJNI(nativePointers, styleInputs, size);
   }
 
   private void freeze(YogaNode parent) {
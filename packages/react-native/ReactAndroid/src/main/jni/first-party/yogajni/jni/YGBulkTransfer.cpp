@@ -0,0 +1,355 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "YGBulkTransfer.h"
+#include "YGNodeEdges.h"
+
+#include <cmath>
+#include <unordered_map>
+
+#include <yoga/enums/Align.h>
+#include <yoga/enums/Direction.h>
+#include <yoga/enums/Display.h>
+#include <yoga/enums/Edge.h>
+#include <yoga/enums/FlexDirection.h>
+#include <yoga/enums/Justify.h>
+#include <yoga/enums/Overflow.h>
+#include <yoga/enums/PositionType.h>
+#include <yoga/enums/Wrap.h>
+
+namespace facebook::yoga::vanillajni {
+
+namespace {
+
+size_t argumentCount(YGStyleInput input) {
+  switch (input) {
+    case YGStyleInput::FlexBasisAuto:
+    case YGStyleInput::WidthAuto:
+    case YGStyleInput::HeightAuto:
+      return 0;
+    case YGStyleInput::Margin:
+    case YGStyleInput::MarginPercent:
+    case YGStyleInput::Padding:
+    case YGStyleInput::PaddingPercent:
+    case YGStyleInput::Border:
+    case YGStyleInput::Position:
+    case YGStyleInput::PositionPercent:
+      return 2;
+    default:
+      return 1;
+  }
+}
+
+template <typename EnumT>
+bool isOrdinal(float value) {
+  return value >= 0 && value < static_cast<float>(ordinalCount<EnumT>()) &&
+      std::floor(value) == value;
+}
+
+// Enum arguments arrive as floats from Java and are checked before they are
+// cast, so that a bad value can't reach Yoga.
+bool hasValidArguments(YGStyleInput input, const float* args) {
+  switch (input) {
+    case YGStyleInput::LayoutDirection:
+      return isOrdinal<Direction>(args[0]);
+    case YGStyleInput::FlexDirection:
+      return isOrdinal<FlexDirection>(args[0]);
+    case YGStyleInput::FlexWrap:
+      return isOrdinal<Wrap>(args[0]);
+    case YGStyleInput::JustifyContent:
+      return isOrdinal<Justify>(args[0]);
+    case YGStyleInput::AlignItems:
+    case YGStyleInput::AlignSelf:
+    case YGStyleInput::AlignContent:
+      return isOrdinal<Align>(args[0]);
+    case YGStyleInput::PositionType:
+      return isOrdinal<PositionType>(args[0]);
+    case YGStyleInput::Overflow:
+      return isOrdinal<Overflow>(args[0]);
+    case YGStyleInput::Display:
+      return isOrdinal<Display>(args[0]);
+    case YGStyleInput::Margin:
+    case YGStyleInput::MarginPercent:
+    case YGStyleInput::MarginAuto:
+    case YGStyleInput::Padding:
+    case YGStyleInput::PaddingPercent:
+    case YGStyleInput::Border:
+    case YGStyleInput::Position:
+    case YGStyleInput::PositionPercent:
+      return isOrdinal<Edge>(args[0]);
+    default:
+      return true;
+  }
+}
+
+void applyStyleInput(YGNodeRef node, YGStyleInput input, const float* args) {
+  const auto edge = [&] { return static_cast<YGEdge>(args[0]); };
+  const auto trackEdge = [&](YGNodeEdges::Edge kind) {
+    YGNodeEdges{node}.add(kind).setOn(node);
+  };
+
+  switch (input) {
+    case YGStyleInput::LayoutDirection:
+      YGNodeStyleSetDirection(node, static_cast<YGDirection>(args[0]));
+      break;
+    case YGStyleInput::FlexDirection:
+      YGNodeStyleSetFlexDirection(node, static_cast<YGFlexDirection>(args[0]));
+      break;
+    case YGStyleInput::Flex:
+      YGNodeStyleSetFlex(node, args[0]);
+      break;
+    case YGStyleInput::FlexGrow:
+      YGNodeStyleSetFlexGrow(node, args[0]);
+      break;
+    case YGStyleInput::FlexShrink:
+      YGNodeStyleSetFlexShrink(node, args[0]);
+      break;
+    case YGStyleInput::FlexBasis:
+      YGNodeStyleSetFlexBasis(node, args[0]);
+      break;
+    case YGStyleInput::FlexBasisPercent:
+      YGNodeStyleSetFlexBasisPercent(node, args[0]);
+      break;
+    case YGStyleInput::FlexBasisAuto:
+      YGNodeStyleSetFlexBasisAuto(node);
+      break;
+    case YGStyleInput::FlexWrap:
+      YGNodeStyleSetFlexWrap(node, static_cast<YGWrap>(args[0]));
+      break;
+    case YGStyleInput::Width:
+      YGNodeStyleSetWidth(node, args[0]);
+      break;
+    case YGStyleInput::WidthPercent:
+      YGNodeStyleSetWidthPercent(node, args[0]);
+      break;
+    case YGStyleInput::WidthAuto:
+      YGNodeStyleSetWidthAuto(node);
+      break;
+    case YGStyleInput::MinWidth:
+      YGNodeStyleSetMinWidth(node, args[0]);
+      break;
+    case YGStyleInput::MinWidthPercent:
+      YGNodeStyleSetMinWidthPercent(node, args[0]);
+      break;
+    case YGStyleInput::MaxWidth:
+      YGNodeStyleSetMaxWidth(node, args[0]);
+      break;
+    case YGStyleInput::MaxWidthPercent:
+      YGNodeStyleSetMaxWidthPercent(node, args[0]);
+      break;
+    case YGStyleInput::Height:
+      YGNodeStyleSetHeight(node, args[0]);
+      break;
+    case YGStyleInput::HeightPercent:
+      YGNodeStyleSetHeightPercent(node, args[0]);
+      break;
+    case YGStyleInput::HeightAuto:
+      YGNodeStyleSetHeightAuto(node);
+      break;
+    case YGStyleInput::MinHeight:
+      YGNodeStyleSetMinHeight(node, args[0]);
+      break;
+    case YGStyleInput::MinHeightPercent:
+      YGNodeStyleSetMinHeightPercent(node, args[0]);
+      break;
+    case YGStyleInput::MaxHeight:
+      YGNodeStyleSetMaxHeight(node, args[0]);
+      break;
+    case YGStyleInput::MaxHeightPercent:
+      YGNodeStyleSetMaxHeightPercent(node, args[0]);
+      break;
+    case YGStyleInput::JustifyContent:
+      YGNodeStyleSetJustifyContent(node, static_cast<YGJustify>(args[0]));
+      break;
+    case YGStyleInput::AlignItems:
+      YGNodeStyleSetAlignItems(node, static_cast<YGAlign>(args[0]));
+      break;
+    case YGStyleInput::AlignSelf:
+      YGNodeStyleSetAlignSelf(node, static_cast<YGAlign>(args[0]));
+      break;
+    case YGStyleInput::AlignContent:
+      YGNodeStyleSetAlignContent(node, static_cast<YGAlign>(args[0]));
+      break;
+    case YGStyleInput::PositionType:
+      YGNodeStyleSetPositionType(node, static_cast<YGPositionType>(args[0]));
+      break;
+    case YGStyleInput::AspectRatio:
+      YGNodeStyleSetAspectRatio(node, args[0]);
+      break;
+    case YGStyleInput::Overflow:
+      YGNodeStyleSetOverflow(node, static_cast<YGOverflow>(args[0]));
+      break;
+    case YGStyleInput::Display:
+      YGNodeStyleSetDisplay(node, static_cast<YGDisplay>(args[0]));
+      break;
+    case YGStyleInput::Margin:
+      trackEdge(YGNodeEdges::MARGIN);
+      YGNodeStyleSetMargin(node, edge(), args[1]);
+      break;
+    case YGStyleInput::MarginPercent:
+      trackEdge(YGNodeEdges::MARGIN);
+      YGNodeStyleSetMarginPercent(node, edge(), args[1]);
+      break;
+    case YGStyleInput::MarginAuto:
+      trackEdge(YGNodeEdges::MARGIN);
+      YGNodeStyleSetMarginAuto(node, edge());
+      break;
+    case YGStyleInput::Padding:
+      trackEdge(YGNodeEdges::PADDING);
+      YGNodeStyleSetPadding(node, edge(), args[1]);
+      break;
+    case YGStyleInput::PaddingPercent:
+      trackEdge(YGNodeEdges::PADDING);
+      YGNodeStyleSetPaddingPercent(node, edge(), args[1]);
+      break;
+    case YGStyleInput::Border:
+      trackEdge(YGNodeEdges::BORDER);
+      YGNodeStyleSetBorder(node, edge(), args[1]);
+      break;
+    case YGStyleInput::Position:
+      YGNodeStyleSetPosition(node, edge(), args[1]);
+      break;
+    case YGStyleInput::PositionPercent:
+      YGNodeStyleSetPositionPercent(node, edge(), args[1]);
+      break;
+    case YGStyleInput::IsReferenceBaseline:
+      YGNodeSetIsReferenceBaseline(node, args[0] == 1.0f);
+      break;
+  }
+}
+
+using NodeIndices = std::unordered_map<YGNodeConstRef, size_t>;
+
+size_t layoutRecordSize(YGNodeEdges edges) {
+  return 7 + (edges.has(YGNodeEdges::MARGIN) ? 4 : 0) +
+      (edges.has(YGNodeEdges::PADDING) ? 4 : 0) +
+      (edges.has(YGNodeEdges::BORDER) ? 4 : 0);
+}
+
+size_t packedLayoutOutputsSize(YGNodeRef node, const NodeIndices& indices) {
+  if (!YGNodeGetHasNewLayout(node) || !indices.contains(node)) {
+    return 0;
+  }
+
+  size_t size = layoutRecordSize(YGNodeEdges{node});
+  for (size_t i = 0; i < YGNodeGetChildCount(node); i++) {
+    size += packedLayoutOutputsSize(YGNodeGetChild(node, i), indices);
+  }
+  return size;
+}
+
+float* packEdges(
+    float* out,
+    YGNodeConstRef node,
+    float (*getter)(YGNodeConstRef, YGEdge)) {
+  *out++ = getter(node, YGEdgeLeft);
+  *out++ = getter(node, YGEdgeTop);
+  *out++ = getter(node, YGEdgeRight);
+  *out++ = getter(node, YGEdgeBottom);
+  return out;
+}
+
+float* packLayoutOutputsRecursive(
+    YGNodeRef node,
+    const NodeIndices& indices,
+    float* out) {
+  if (!YGNodeGetHasNewLayout(node)) {
+    return out;
+  }
+  auto index = indices.find(node);
+  if (index == indices.end()) {
+    return out;
+  }
+
+  auto edges = YGNodeEdges{node};
+  *out++ = static_cast<float>(index->second);
+  *out++ = static_cast<float>(edges.get() | HAS_NEW_LAYOUT);
+  *out++ = YGNodeLayoutGetWidth(node);
+  *out++ = YGNodeLayoutGetHeight(node);
+  *out++ = YGNodeLayoutGetLeft(node);
+  *out++ = YGNodeLayoutGetTop(node);
+  *out++ = static_cast<float>(YGNodeLayoutGetDirection(node));
+  if (edges.has(YGNodeEdges::MARGIN)) {
+    out = packEdges(out, node, YGNodeLayoutGetMargin);
+  }
+  if (edges.has(YGNodeEdges::PADDING)) {
+    out = packEdges(out, node, YGNodeLayoutGetPadding);
+  }
+  if (edges.has(YGNodeEdges::BORDER)) {
+    out = packEdges(out, node, YGNodeLayoutGetBorder);
+  }
+
+  YGNodeSetHasNewLayout(node, false);
+
+  for (size_t i = 0; i < YGNodeGetChildCount(node); i++) {
+    out = packLayoutOutputsRecursive(YGNodeGetChild(node, i), indices, out);
+  }
+  return out;
+}
+
+} // namespace
+
+size_t applyStyleInputs(YGNodeRef node, std::span<const float> inputs) {
+  size_t offset = 0;
+  while (offset < inputs.size()) {
+    const auto key = static_cast<int>(inputs[offset]);
+    if (key < 0 || key > static_cast<int>(YGStyleInput::IsReferenceBaseline)) {
+      break;
+    }
+
+    const auto input = static_cast<YGStyleInput>(key);
+    const size_t argc = argumentCount(input);
+    if (offset + 1 + argc > inputs.size()) {
+      break;
+    }
+
+    const float* args = inputs.data() + offset + 1;
+    if (hasValidArguments(input, args)) {
+      applyStyleInput(node, input, args);
+    }
+    offset += 1 + argc;
+  }
+  return offset;
+}
+
+size_t applyStyleInputsToNodes(
+    std::span<const YGNodeRef> nodes,
+    std::span<const float> inputs) {
+  size_t offset = 0;
+  for (auto node : nodes) {
+    if (offset >= inputs.size()) {
+      break;
+    }
+    const float count = inputs[offset++];
+    if (!(count >= 0) || count > static_cast<float>(inputs.size() - offset)) {
+      break;
+    }
+    applyStyleInputs(
+        node, inputs.subspan(offset, static_cast<size_t>(count)));
+    offset += static_cast<size_t>(count);
+  }
+  return offset;
+}
+
+size_t packLayoutOutputs(
+    YGNodeRef root,
+    std::span<const YGNodeConstRef> nodes,
+    std::span<float> out) {
+  auto indices = NodeIndices{};
+  indices.reserve(nodes.size());
+  for (size_t i = 0; i < nodes.size(); i++) {
+    indices.emplace(nodes[i], i);
+  }
+
+  const size_t size = packedLayoutOutputsSize(root, indices);
+  if (size <= out.size()) {
+    packLayoutOutputsRecursive(root, indices, out.data());
+  }
+  return size;
+}
+
+} // namespace facebook::yoga::vanillajni
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <span>
+
+#include <yoga/Yoga.h>
+
+// Packing and unpacking of the flat buffers used to move style and layout
+// across the JNI boundary in bulk. Nothing in here depends on JNI, so the
+// format can be exercised on the host.
+namespace facebook::yoga::vanillajni {
+
+// Style input keys. Must be kept in sync with YogaStyleInputs.java.
+enum class YGStyleInput : int {
+  LayoutDirection,
+  FlexDirection,
+  Flex,
+  FlexGrow,
+  FlexShrink,
+  FlexBasis,
+  FlexBasisPercent,
+  FlexBasisAuto,
+  FlexWrap,
+  Width,
+  WidthPercent,
+  WidthAuto,
+  MinWidth,
+  MinWidthPercent,
+  MaxWidth,
+  MaxWidthPercent,
+  Height,
+  HeightPercent,
+  HeightAuto,
+  MinHeight,
+  MinHeightPercent,
+  MaxHeight,
+  MaxHeightPercent,
+  JustifyContent,
+  AlignItems,
+  AlignSelf,
+  AlignContent,
+  PositionType,
+  AspectRatio,
+  Overflow,
+  Display,
+  Margin,
+  MarginPercent,
+  MarginAuto,
+  Padding,
+  PaddingPercent,
+  Border,
+  Position,
+  PositionPercent,
+  IsReferenceBaseline,
+};
+
+// Applies a sequence of style inputs to a node. Each input is its key
+// followed by its arguments: none for the Auto variants, an edge for
+// MarginAuto, an edge and a value for the other edge properties, and a value
+// for everything else. Inputs with an enum argument that is out of range are
+// skipped. Returns the number of floats consumed, which is less than
+// inputs.size() only if the sequence ends with a truncated or unknown input.
+size_t applyStyleInputs(YGNodeRef node, std::span<const float> inputs);
+
+// Applies style inputs to a list of nodes. For every node, in order, the
+// buffer holds the number of floats that follow for that node and then that
+// node's style inputs. Returns the number of floats consumed.
+size_t applyStyleInputsToNodes(
+    std::span<const YGNodeRef> nodes,
+    std::span<const float> inputs);
+
+// Writes the layout of every node of the subtree rooted at root with a new
+// layout into out, in pre-order, and marks the layout as seen. Every record
+// starts with the position of the node in nodes, which is the list of nodes
+// handed over from Java, followed by the same values as the per-node "arr"
+// field on YogaNodeJNIBase: the flags word, the frame, direction and the
+// margin, padding and border edges that are tracked for the node.
+//
+// Yoga may hold clones of shared children that Java does not know about, so
+// the reader must not rely on the order of the records. Like the per-node
+// transfer, a node without a new layout or missing from nodes is skipped
+// together with its subtree.
+//
+// Returns the number of floats needed. Nothing is written, and no layout is
+// marked as seen, when that is more than out.size().
+size_t packLayoutOutputs(
+    YGNodeRef root,
+    std::span<const YGNodeConstRef> nodes,
+    std::span<float> out);
+
+} // namespace facebook::yoga::vanillajni
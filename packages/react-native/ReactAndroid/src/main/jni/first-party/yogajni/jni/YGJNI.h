@@ -7,61 +7,10 @@
 
 #include <yoga/Yoga.h>
 
-const short int LAYOUT_EDGE_SET_FLAG_INDEX = 0;
-const short int LAYOUT_WIDTH_INDEX = 1;
-const short int LAYOUT_HEIGHT_INDEX = 2;
-const short int LAYOUT_LEFT_INDEX = 3;
-const short int LAYOUT_TOP_INDEX = 4;
-const short int LAYOUT_DIRECTION_INDEX = 5;
-const short int LAYOUT_MARGIN_START_INDEX = 6;
-const short int LAYOUT_PADDING_START_INDEX = 10;
-const short int LAYOUT_BORDER_START_INDEX = 14;
+#include "YGNodeEdges.h"
 
 namespace {
 
-const int HAS_NEW_LAYOUT = 16;
-
-union YGNodeContext {
-  int32_t edgesSet = 0;
-  void* asVoidPtr;
-};
-
-class YGNodeEdges {
-  int32_t edges_;
-
- public:
-  enum Edge {
-    MARGIN = 1,
-    PADDING = 2,
-    BORDER = 4,
-  };
-
-  explicit YGNodeEdges(YGNodeRef node) {
-    auto context = YGNodeContext{};
-    context.asVoidPtr = YGNodeGetContext(node);
-    edges_ = context.edgesSet;
-  }
-
-  void setOn(YGNodeRef node) {
-    auto context = YGNodeContext{};
-    context.edgesSet = edges_;
-    YGNodeSetContext(node, context.asVoidPtr);
-  }
-
-  bool has(Edge edge) {
-    return (edges_ & edge) == edge;
-  }
-
-  YGNodeEdges& add(Edge edge) {
-    edges_ |= edge;
-    return *this;
-  }
-
-  int get() {
-    return edges_;
-  }
-};
-
 struct YogaValue {
   static constexpr jint NAN_BYTES = 0x7fc00000;
 
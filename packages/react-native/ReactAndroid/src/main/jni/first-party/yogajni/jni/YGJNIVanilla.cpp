@@ -6,11 +6,15 @@
  */
 
 #include "YGJNIVanilla.h"
+#include <algorithm>
 #include <bit>
 #include <cstring>
 #include <iostream>
 #include <memory>
+#include <span>
+#include <vector>
 #include "LayoutContext.h"
+#include "YGBulkTransfer.h"
 #include "YGJNI.h"
 #include "YGJTypesVanilla.h"
 #include "YogaJniException.h"
@@ -332,14 +336,33 @@ YGTransferLayoutOutputsRecursive(JNIEnv* env, jobject thiz, YGNodeRef root) {
   }
 }
 
-static void jni_YGNodeCalculateLayoutJNI(
+static std::span<float> YGDirectFloatBuffer(JNIEnv* env, jobject buffer) {
+  auto data = static_cast<float*>(env->GetDirectBufferAddress(buffer));
+  if (data == nullptr) {
+    return {};
+  }
+  auto capacity = env->GetDirectBufferCapacity(buffer);
+  return {data, static_cast<size_t>(capacity) / sizeof(float)};
+}
+
+static void YGThrowLayoutException(JNIEnv* env, const std::logic_error& ex) {
+  env->ExceptionClear();
+  jclass cl = env->FindClass("java/lang/IllegalStateException");
+  static const jmethodID methodId = facebook::yoga::vanillajni::getMethodId(
+      env, cl, "<init>", "(Ljava/lang/String;)V");
+  auto throwable = env->NewObject(cl, methodId, env->NewStringUTF(ex.what()));
+  env->Throw(static_cast<jthrowable>(throwable));
+}
+
+template <typename TransferLayoutOutputs>
+static void YGCalculateLayoutJNI(
     JNIEnv* env,
-    jobject obj,
     jlong nativePointer,
     jfloat width,
     jfloat height,
     jlongArray nativePointers,
-    jobjectArray javaNodes) {
+    jobjectArray javaNodes,
+    TransferLayoutOutputs&& transferLayoutOutputs) {
   try {
     PtrJNodeMapVanilla* layoutContext = nullptr;
     auto map = PtrJNodeMapVanilla{};
@@ -356,20 +379,132 @@ static void jni_YGNodeCalculateLayoutJNI(
         static_cast<float>(width),
         static_cast<float>(height),
         YGNodeStyleGetDirection(_jlong2YGNodeRef(nativePointer)));
-    YGTransferLayoutOutputsRecursive(env, obj, root);
+    transferLayoutOutputs(root);
   } catch (const YogaJniException& jniException) {
     ScopedLocalRef<jthrowable> throwable = jniException.getThrowable();
     if (throwable.get() != nullptr) {
       env->Throw(throwable.get());
     }
   } catch (const std::logic_error& ex) {
-    env->ExceptionClear();
-    jclass cl = env->FindClass("java/lang/IllegalStateException");
-    static const jmethodID methodId = facebook::yoga::vanillajni::getMethodId(
-        env, cl, "<init>", "(Ljava/lang/String;)V");
-    auto throwable = env->NewObject(cl, methodId, env->NewStringUTF(ex.what()));
-    env->Throw(static_cast<jthrowable>(throwable));
+    YGThrowLayoutException(env, ex);
+  }
+}
+
+static void jni_YGNodeCalculateLayoutJNI(
+    JNIEnv* env,
+    jobject obj,
+    jlong nativePointer,
+    jfloat width,
+    jfloat height,
+    jlongArray nativePointers,
+    jobjectArray javaNodes) {
+  YGCalculateLayoutJNI(
+      env,
+      nativePointer,
+      width,
+      height,
+      nativePointers,
+      javaNodes,
+      [&](YGNodeRef root) { YGTransferLayoutOutputsRecursive(env, obj, root); });
+}
+
+static std::vector<YGNodeConstRef> YGNodeRefsFromPointers(
+    JNIEnv* env,
+    jlongArray nativePointers) {
+  jsize nodeCount = env->GetArrayLength(nativePointers);
+  std::vector<jlong> pointers(static_cast<size_t>(nodeCount));
+  env->GetLongArrayRegion(nativePointers, 0, nodeCount, pointers.data());
+
+  std::vector<YGNodeConstRef> nodes;
+  nodes.reserve(pointers.size());
+  for (auto pointer : pointers) {
+    nodes.push_back(_jlong2YGNodeRef(pointer));
   }
+  return nodes;
+}
+
+// Same as jni_YGNodeCalculateLayoutJNI, but writes the new layout of the whole
+// tree into a direct ByteBuffer (see packLayoutOutputs) instead of setting a
+// float array on every Java node. Returns the number of floats needed; when
+// that is larger than the buffer nothing is written, and the layout can be
+// fetched with jni_YGNodeTransferLayoutToBufferJNI into a larger buffer.
+static jint jni_YGNodeCalculateLayoutToBufferJNI(
+    JNIEnv* env,
+    jobject /*obj*/,
+    jlong nativePointer,
+    jfloat width,
+    jfloat height,
+    jlongArray nativePointers,
+    jobjectArray javaNodes,
+    jobject layoutBuffer) {
+  size_t size = 0;
+  YGCalculateLayoutJNI(
+      env,
+      nativePointer,
+      width,
+      height,
+      nativePointers,
+      javaNodes,
+      [&](YGNodeRef root) {
+        size = packLayoutOutputs(
+            root,
+            YGNodeRefsFromPointers(env, nativePointers),
+            YGDirectFloatBuffer(env, layoutBuffer));
+      });
+  return static_cast<jint>(size);
+}
+
+static jint jni_YGNodeTransferLayoutToBufferJNI(
+    JNIEnv* env,
+    jobject /*obj*/,
+    jlong nativePointer,
+    jlongArray nativePointers,
+    jobject layoutBuffer) {
+  return static_cast<jint>(packLayoutOutputs(
+      _jlong2YGNodeRef(nativePointer),
+      YGNodeRefsFromPointers(env, nativePointers),
+      YGDirectFloatBuffer(env, layoutBuffer)));
+}
+
+static void jni_YGNodeSetStyleInputsJNI(
+    JNIEnv* env,
+    jobject /*obj*/,
+    jlong nativePointer,
+    jfloatArray styleInputs,
+    jint size) {
+  const auto length = static_cast<size_t>(std::clamp(
+      size, static_cast<jint>(0), env->GetArrayLength(styleInputs)));
+  // No JNI calls are made while the array is pinned
+  auto inputs =
+      static_cast<float*>(env->GetPrimitiveArrayCritical(styleInputs, nullptr));
+  if (inputs == nullptr) {
+    return;
+  }
+  applyStyleInputs(
+      _jlong2YGNodeRef(nativePointer),
+      std::span<const float>{inputs, length});
+  env->ReleasePrimitiveArrayCritical(styleInputs, inputs, JNI_ABORT);
+}
+
+static void jni_YGNodeSetStyleInputsForNodesJNI(
+    JNIEnv* env,
+    jobject /*obj*/,
+    jlongArray nativePointers,
+    jobject styleInputs,
+    jint size) {
+  jsize nodeCount = env->GetArrayLength(nativePointers);
+  std::vector<jlong> pointers(static_cast<size_t>(nodeCount));
+  env->GetLongArrayRegion(nativePointers, 0, nodeCount, pointers.data());
+
+  std::vector<YGNodeRef> nodes;
+  nodes.reserve(pointers.size());
+  for (auto pointer : pointers) {
+    nodes.push_back(_jlong2YGNodeRef(pointer));
+  }
+
+  auto inputs = YGDirectFloatBuffer(env, styleInputs);
+  applyStyleInputsToNodes(
+      nodes, inputs.first(std::min(inputs.size(), static_cast<size_t>(size))));
 }
 
 static void
@@ -754,6 +889,18 @@ static JNINativeMethod methods[] = {
     {"jni_YGNodeCalculateLayoutJNI",
      "(JFF[J[Lcom/facebook/yoga/YogaNodeJNIBase;)V",
      (void*)jni_YGNodeCalculateLayoutJNI},
+    {"jni_YGNodeCalculateLayoutToBufferJNI",
+     "(JFF[J[Lcom/facebook/yoga/YogaNodeJNIBase;Ljava/nio/ByteBuffer;)I",
+     (void*)jni_YGNodeCalculateLayoutToBufferJNI},
+    {"jni_YGNodeTransferLayoutToBufferJNI",
+     "(J[JLjava/nio/ByteBuffer;)I",
+     (void*)jni_YGNodeTransferLayoutToBufferJNI},
+    {"jni_YGNodeSetStyleInputsJNI",
+     "(J[FI)V",
+     (void*)jni_YGNodeSetStyleInputsJNI},
+    {"jni_YGNodeSetStyleInputsForNodesJNI",
+     "([JLjava/nio/ByteBuffer;I)V",
+     (void*)jni_YGNodeSetStyleInputsForNodesJNI},
     {"jni_YGNodeMarkDirtyJNI", "(J)V", (void*)jni_YGNodeMarkDirtyJNI},
     {"jni_YGNodeIsDirtyJNI", "(J)Z", (void*)jni_YGNodeIsDirtyJNI},
     {"jni_YGNodeCopyStyleJNI", "(JJ)V", (void*)jni_YGNodeCopyStyleJNI},
@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "../jni/YGBulkTransfer.h"
+#include "../jni/YGNodeEdges.h"
+
+using namespace facebook::yoga::vanillajni;
+
+namespace {
+
+float key(YGStyleInput input) {
+  return static_cast<float>(input);
+}
+
+/*
+ * A root with two children of 10x10 and 20x20 laid out in a row.
+ */
+class YGBulkTransferTest : public ::testing::Test {
+ protected:
+  YGBulkTransferTest() {
+    root_ = YGNodeNew();
+    YGNodeStyleSetFlexDirection(root_, YGFlexDirectionRow);
+    for (float size : {10.0f, 20.0f}) {
+      auto child = YGNodeNew();
+      YGNodeStyleSetWidth(child, size);
+      YGNodeStyleSetHeight(child, size);
+      YGNodeInsertChild(root_, child, YGNodeGetChildCount(root_));
+    }
+    nodes_ = {root_, YGNodeGetChild(root_, 0), YGNodeGetChild(root_, 1)};
+  }
+
+  ~YGBulkTransferTest() override {
+    YGNodeFreeRecursive(root_);
+  }
+
+  void calculateLayout() {
+    YGNodeCalculateLayout(root_, 100, 100, YGDirectionLTR);
+  }
+
+  YGNodeRef root_;
+  std::vector<YGNodeConstRef> nodes_;
+};
+
+} // namespace
+
+TEST_F(YGBulkTransferTest, styleInputsAreApplied) {
+  const std::vector<float> inputs = {
+      key(YGStyleInput::FlexDirection),
+      static_cast<float>(YGFlexDirectionColumn),
+      key(YGStyleInput::WidthAuto),
+      key(YGStyleInput::Margin),
+      static_cast<float>(YGEdgeLeft),
+      5,
+  };
+
+  EXPECT_EQ(applyStyleInputs(root_, inputs), inputs.size());
+  EXPECT_EQ(YGNodeStyleGetFlexDirection(root_), YGFlexDirectionColumn);
+  EXPECT_EQ(YGNodeStyleGetWidth(root_).unit, YGUnitAuto);
+  EXPECT_EQ(YGNodeStyleGetMargin(root_, YGEdgeLeft).value, 5);
+  EXPECT_TRUE(YGNodeEdges{root_}.has(YGNodeEdges::MARGIN));
+}
+
+TEST_F(YGBulkTransferTest, styleInputsWithInvalidEnumsAreSkipped) {
+  const std::vector<float> inputs = {
+      key(YGStyleInput::FlexDirection),
+      100,
+      key(YGStyleInput::AlignItems),
+      -1,
+      key(YGStyleInput::Display),
+      0.5f,
+      key(YGStyleInput::Padding),
+      std::numeric_limits<float>::quiet_NaN(),
+      5,
+      key(YGStyleInput::Width),
+      42,
+  };
+
+  EXPECT_EQ(applyStyleInputs(root_, inputs), inputs.size());
+  EXPECT_EQ(YGNodeStyleGetFlexDirection(root_), YGFlexDirectionRow);
+  EXPECT_EQ(YGNodeStyleGetAlignItems(root_), YGAlignStretch);
+  EXPECT_EQ(YGNodeStyleGetDisplay(root_), YGDisplayFlex);
+  EXPECT_FALSE(YGNodeEdges{root_}.has(YGNodeEdges::PADDING));
+  EXPECT_EQ(YGNodeStyleGetWidth(root_).value, 42);
+}
+
+TEST_F(YGBulkTransferTest, truncatedOrUnknownStyleInputsStopTheSequence) {
+  EXPECT_EQ(
+      applyStyleInputs(root_, std::vector<float>{key(YGStyleInput::Width)}),
+      0);
+  EXPECT_EQ(
+      applyStyleInputs(
+          root_, std::vector<float>{key(YGStyleInput::Width), 10, 1000, 1}),
+      2);
+  EXPECT_EQ(YGNodeStyleGetWidth(root_).value, 10);
+}
+
+TEST_F(YGBulkTransferTest, styleInputsAreAppliedToNodes) {
+  const std::vector<YGNodeRef> nodes = {
+      YGNodeGetChild(root_, 0), YGNodeGetChild(root_, 1)};
+  const std::vector<float> inputs = {
+      2,
+      key(YGStyleInput::Height),
+      30,
+      2,
+      key(YGStyleInput::Height),
+      40,
+  };
+
+  EXPECT_EQ(applyStyleInputsToNodes(nodes, inputs), inputs.size());
+  EXPECT_EQ(YGNodeStyleGetHeight(nodes[0]).value, 30);
+  EXPECT_EQ(YGNodeStyleGetHeight(nodes[1]).value, 40);
+}
+
+TEST_F(YGBulkTransferTest, invalidStyleInputCountsAreRejected) {
+  const std::vector<YGNodeRef> nodes = {YGNodeGetChild(root_, 0)};
+
+  EXPECT_EQ(applyStyleInputsToNodes(nodes, std::vector<float>{-1, 0}), 1);
+  EXPECT_EQ(applyStyleInputsToNodes(nodes, std::vector<float>{3, 0}), 1);
+  EXPECT_EQ(
+      applyStyleInputsToNodes(
+          nodes, std::vector<float>{std::numeric_limits<float>::quiet_NaN()}),
+      1);
+}
+
+TEST_F(YGBulkTransferTest, layoutIsPackedByNodeIndex) {
+  calculateLayout();
+
+  std::vector<float> out(3 * 7);
+  ASSERT_EQ(packLayoutOutputs(root_, nodes_, out), out.size());
+
+  // Pre-order: the root, then the children.
+  // clang-format off
+  const std::vector<float> expected = {
+      0, HAS_NEW_LAYOUT, 100, 100, 0,  0, YGDirectionLTR,
+      1, HAS_NEW_LAYOUT, 10,  10,  0,  0, YGDirectionLTR,
+      2, HAS_NEW_LAYOUT, 20,  20,  10, 0, YGDirectionLTR,
+  };
+  // clang-format on
+  EXPECT_EQ(out, expected);
+
+  EXPECT_FALSE(YGNodeGetHasNewLayout(root_));
+  EXPECT_EQ(packLayoutOutputs(root_, nodes_, out), 0);
+}
+
+TEST_F(YGBulkTransferTest, trackedEdgesArePacked) {
+  YGNodeEdges{root_}.add(YGNodeEdges::BORDER).setOn(root_);
+  YGNodeStyleSetBorder(root_, YGEdgeAll, 1);
+  calculateLayout();
+
+  std::vector<float> out(64);
+  ASSERT_EQ(packLayoutOutputs(root_, nodes_, out), 3 * 7 + 4);
+  EXPECT_EQ(out[1], HAS_NEW_LAYOUT | YGNodeEdges::BORDER);
+  EXPECT_EQ(
+      std::vector<float>(out.begin() + 7, out.begin() + 11),
+      std::vector<float>({1, 1, 1, 1}));
+  EXPECT_EQ(out[11], 1);
+}
+
+TEST_F(YGBulkTransferTest, nothingIsWrittenIntoASmallBuffer) {
+  calculateLayout();
+
+  std::vector<float> out(3 * 7 - 1, -1);
+  EXPECT_EQ(packLayoutOutputs(root_, nodes_, out), 3 * 7);
+  EXPECT_EQ(out, std::vector<float>(3 * 7 - 1, -1));
+  EXPECT_TRUE(YGNodeGetHasNewLayout(root_));
+
+  // Retrying with a large enough buffer transfers the layout.
+  out.resize(3 * 7);
+  EXPECT_EQ(packLayoutOutputs(root_, nodes_, out), 3 * 7);
+  EXPECT_EQ(out[0], 0);
+}
+
+TEST_F(YGBulkTransferTest, nodesUnknownToTheCallerAreSkipped) {
+  calculateLayout();
+
+  // The caller does not know about the first child, like a clone that Yoga
+  // made of a shared child.
+  const std::vector<YGNodeConstRef> nodes = {YGNodeGetChild(root_, 1), root_};
+  std::vector<float> out(64);
+  ASSERT_EQ(packLayoutOutputs(root_, nodes, out), 2 * 7);
+  EXPECT_EQ(out[0], 1);
+  EXPECT_EQ(out[7], 0);
+  EXPECT_EQ(out[9], 20);
+  EXPECT_TRUE(YGNodeGetHasNewLayout(YGNodeGetChild(root_, 0)));
+}
+
+TEST_F(YGBulkTransferTest, subtreesWithoutNewLayoutAreSkipped) {
+  calculateLayout();
+  YGNodeSetHasNewLayout(YGNodeGetChild(root_, 0), false);
+
+  std::vector<float> out(64);
+  ASSERT_EQ(packLayoutOutputs(root_, nodes_, out), 2 * 7);
+  EXPECT_EQ(out[0], 0);
+  EXPECT_EQ(out[7], 2);
+}
@@ -290,6 +290,18 @@ void FabricMountingManager::executeMount(
           }
           break;
         }
+        case ShadowViewMutation::Move: {
+          // Only generated when `PlatformSupportsMoveInstruction` is enabled,
+          // which it is not on Android yet: there is no mount item to reorder
+          // a view, so the view is removed and inserted again.
+          if (!isVirtual) {
+            cppCommonMountItems.push_back(CppMountItem::RemoveMountItem(
+                parentShadowView, newChildShadowView, mutation.fromIndex));
+            cppCommonMountItems.push_back(CppMountItem::InsertMountItem(
+                parentShadowView, newChildShadowView, index));
+          }
+          break;
+        }
         case ShadowViewMutation::RemoveDeleteTree: {
           if (!isVirtual) {
             cppCommonMountItems.push_back(
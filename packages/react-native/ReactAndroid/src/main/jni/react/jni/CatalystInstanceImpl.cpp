@@ -14,6 +14,7 @@
 #include <cxxreact/CxxNativeModule.h>
 #include <cxxreact/Instance.h>
 #include <cxxreact/JSBigString.h>
+#include <cxxreact/JSBigStringRegistry.h>
 #include <cxxreact/JSBundleType.h>
 #include <cxxreact/JSIndexedRAMBundle.h>
 #include <cxxreact/MethodCall.h>
@@ -274,10 +275,10 @@ void CatalystInstanceImpl::jniLoadScriptFromFile(
       break;
     case ScriptTag::String:
     default: {
-      std::unique_ptr<const JSBigFileString> script;
+      std::unique_ptr<const JSBigString> script;
       RecoverableError::runRethrowingAsRecoverable<std::system_error>(
           [&fileName, &script]() {
-            script = JSBigFileString::fromPath(fileName);
+            script = JSBigStringRegistry::shared().fromPath(fileName);
           });
       instance_->loadScriptFromString(
           std::move(script), sourceURL, loadSynchronously);
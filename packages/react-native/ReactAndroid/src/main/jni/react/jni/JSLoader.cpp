@@ -9,6 +9,7 @@
 
 #include <android/asset_manager_jni.h>
 #include <cxxreact/JSBigString.h>
+#include <cxxreact/JSBigStringRegistry.h>
 #include <cxxreact/JSBundleType.h>
 #include <fbjni/fbjni.h>
 #include <folly/Conv.h>
@@ -70,20 +71,26 @@ loadScriptFromAssets(AAssetManager* manager, const std::string& assetName) {
                                 // AssetManager.java for docs
     if (asset) {
       auto script = std::make_unique<AssetManagerString>(asset);
-      if (script->size() >= sizeof(BundleHeader)) {
-        // When using bytecode, it's safe for the underlying buffer to not be \0
-        // terminated. In all other scenarios, we will force a copy of the
-        // script to ensure we have a terminator.
-        const BundleHeader* header =
-            reinterpret_cast<const BundleHeader*>(script->c_str());
-        if (isHermesBytecodeBundle(*header)) {
-          return script;
-        }
-      }
-
-      auto buf = std::make_unique<JSBigBufferString>(script->size());
-      memcpy(buf->data(), script->c_str(), script->size());
-      return buf;
+      // Assets don't change while the app is running: instances loading the
+      // same one share its contents.
+      return JSBigStringRegistry::shared().getOrCreate(
+          "asset:" + assetName,
+          [&script]() -> std::unique_ptr<const JSBigString> {
+            if (script->size() >= sizeof(BundleHeader)) {
+              // When using bytecode, it's safe for the underlying buffer to not
+              // be \0 terminated. In all other scenarios, we will force a copy
+              // of the script to ensure we have a terminator.
+              const BundleHeader* header =
+                  reinterpret_cast<const BundleHeader*>(script->c_str());
+              if (isHermesBytecodeBundle(*header)) {
+                return std::move(script);
+              }
+            }
+
+            auto buf = std::make_unique<JSBigBufferString>(script->size());
+            memcpy(buf->data(), script->c_str(), script->size());
+            return buf;
+          });
     }
   }
 
@@ -12,6 +12,7 @@
 #endif
 
 #include <cxxreact/JSBigString.h>
+#include <cxxreact/JSBigStringRegistry.h>
 #include <cxxreact/RecoverableError.h>
 #include <fbjni/fbjni.h>
 #include <glog/logging.h>
@@ -149,9 +150,11 @@ void JReactInstance::loadJSBundleFromAssets(
 void JReactInstance::loadJSBundleFromFile(
     const std::string& fileName,
     const std::string& sourceURL) {
-  std::unique_ptr<const JSBigFileString> script;
+  std::unique_ptr<const JSBigString> script;
   RecoverableError::runRethrowingAsRecoverable<std::system_error>(
-      [&fileName, &script]() { script = JSBigFileString::fromPath(fileName); });
+      [&fileName, &script]() {
+        script = JSBigStringRegistry::shared().fromPath(fileName);
+      });
   instance_->loadScript(std::move(script), sourceURL);
 }
 
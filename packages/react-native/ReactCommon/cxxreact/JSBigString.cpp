@@ -9,6 +9,7 @@
 
 #include <glog/logging.h>
 
+#include <folly/Conv.h>
 #include <folly/Memory.h>
 #include <folly/portability/Fcntl.h>
 #include <folly/portability/SysMman.h>
@@ -19,6 +20,24 @@
 
 namespace facebook::react {
 
+namespace {
+
+// Modification time with the finest resolution the platform provides, so that
+// a file rewritten within the same second still gets a new key.
+std::string modificationTime(const struct stat& fileInfo) {
+#if defined(__APPLE__)
+  const auto& modified = fileInfo.st_mtimespec;
+  return folly::to<std::string>(modified.tv_sec, '.', modified.tv_nsec);
+#elif defined(_WIN32)
+  return folly::to<std::string>(fileInfo.st_mtime);
+#else
+  const auto& modified = fileInfo.st_mtim;
+  return folly::to<std::string>(modified.tv_sec, '.', modified.tv_nsec);
+#endif
+}
+
+} // namespace
+
 JSBigFileString::JSBigFileString(int fd, size_t size, off_t offset /*= 0*/)
     : m_fd{-1}, m_data{nullptr} {
   m_fd = dup(fd);
@@ -114,4 +133,22 @@ std::unique_ptr<const JSBigFileString> JSBigFileString::fromPath(
   return ptr;
 }
 
+std::string JSBigFileString::versionKey(const std::string& path) {
+  struct stat fileInfo {};
+  if (::stat(path.c_str(), &fileInfo) == -1) {
+    return {};
+  }
+
+  return folly::to<std::string>(
+      path,
+      ':',
+      fileInfo.st_dev,
+      ':',
+      fileInfo.st_ino,
+      ':',
+      fileInfo.st_size,
+      ':',
+      modificationTime(fileInfo));
+}
+
 } // namespace facebook::react
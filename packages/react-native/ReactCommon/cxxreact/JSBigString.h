@@ -124,6 +124,11 @@ class RN_EXPORT JSBigFileString : public JSBigString {
   static std::unique_ptr<const JSBigFileString> fromPath(
       const std::string& sourceURL);
 
+  // Returns a key identifying the current version of the file at `path` by
+  // its path, device, inode, size and modification time (in nanoseconds where
+  // available), or an empty string if the file can't be stat'ed.
+  static std::string versionKey(const std::string& path);
+
  private:
   int m_fd; // The file descriptor being mmapped
   size_t m_size; // The size of the mmapped region
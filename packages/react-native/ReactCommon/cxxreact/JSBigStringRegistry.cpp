@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "JSBigStringRegistry.h"
+
+#include <utility>
+
+namespace facebook::react {
+
+JSBigStringRegistry& JSBigStringRegistry::shared() {
+  // Intentionally leaked: bundles may be released while static destructors
+  // run.
+  static auto* registry = new JSBigStringRegistry();
+  return *registry;
+}
+
+std::unique_ptr<const JSBigString> JSBigStringRegistry::fromPath(
+    const std::string& path) {
+  auto versionKey = JSBigFileString::versionKey(path);
+  if (versionKey.empty()) {
+    // Let JSBigFileString report the error.
+    return JSBigFileString::fromPath(path);
+  }
+
+  auto key = "file:" + versionKey;
+  return getOrCreate(
+      key, [&path]() { return JSBigFileString::fromPath(path); });
+}
+
+std::unique_ptr<const JSBigString> JSBigStringRegistry::getOrCreate(
+    const std::string& key,
+    const std::function<std::unique_ptr<const JSBigString>()>& create) {
+  {
+    std::scoped_lock lock(m_mutex);
+    auto it = m_strings.find(key);
+    if (it != m_strings.end()) {
+      if (auto str = it->second.lock()) {
+        return std::make_unique<JSBigSharedString>(std::move(str));
+      }
+    }
+  }
+
+  // Creating the contents maps or copies a whole bundle, so it happens
+  // outside of the lock.
+  std::shared_ptr<const JSBigString> str = create();
+  // JSBigFileString maps its file lazily, which is not safe to do from
+  // several threads at once; map it before sharing it.
+  str->c_str();
+
+  // Released after the lock.
+  auto discarded = std::shared_ptr<const JSBigString>{};
+  {
+    std::scoped_lock lock(m_mutex);
+    auto& entry = m_strings[key];
+    if (auto registered = entry.lock()) {
+      // Another thread registered the same contents in the meantime: share
+      // them rather than keeping a second copy.
+      discarded = std::exchange(str, std::move(registered));
+    } else {
+      entry = str;
+    }
+
+    for (auto it = m_strings.begin(); it != m_strings.end();) {
+      if (it->second.expired()) {
+        it = m_strings.erase(it);
+      } else {
+        it++;
+      }
+    }
+  }
+  return std::make_unique<JSBigSharedString>(std::move(str));
+}
+
+size_t JSBigStringRegistry::size() const {
+  std::scoped_lock lock(m_mutex);
+  size_t size = 0;
+  for (const auto& [key, str] : m_strings) {
+    if (!str.expired()) {
+      size++;
+    }
+  }
+  return size;
+}
+
+} // namespace facebook::react
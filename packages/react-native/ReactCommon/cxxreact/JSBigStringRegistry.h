@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include <cxxreact/JSBigString.h>
+
+namespace facebook::react {
+
+// JSBigString sharing the contents of another, immutable JSBigString. Lets a
+// shared bundle be passed wherever a std::unique_ptr<const JSBigString> is
+// expected.
+class RN_EXPORT JSBigSharedString : public JSBigString {
+ public:
+  explicit JSBigSharedString(std::shared_ptr<const JSBigString> str)
+      : m_str(std::move(str)) {}
+
+  bool isAscii() const override {
+    return m_str->isAscii();
+  }
+
+  const char* c_str() const override {
+    return m_str->c_str();
+  }
+
+  size_t size() const override {
+    return m_str->size();
+  }
+
+ private:
+  std::shared_ptr<const JSBigString> m_str;
+};
+
+// Process-wide registry of immutable bundle contents. Instances loading the
+// same bundle (e.g. hosts running many isolated surfaces) share one mapping or
+// copy of it instead of creating their own. Entries are refcounted: the
+// contents are released once no instance holds them anymore.
+// The class is thread-safe.
+class RN_EXPORT JSBigStringRegistry {
+ public:
+  static JSBigStringRegistry& shared();
+
+  // Returns the contents of the file at `path`, mapped once per version of the
+  // file (identified by its device, inode, size and modification time in
+  // nanoseconds where available).
+  std::unique_ptr<const JSBigString> fromPath(const std::string& path);
+
+  // Returns the contents registered under `key`, calling `create` if there are
+  // none. `key` must identify immutable contents. `create` runs without the
+  // registry locked; if concurrent callers both create the contents, the
+  // first one registered is shared and the others are released.
+  std::unique_ptr<const JSBigString> getOrCreate(
+      const std::string& key,
+      const std::function<std::unique_ptr<const JSBigString>()>& create);
+
+  // Number of contents currently held by some instance.
+  size_t size() const;
+
+ private:
+  mutable std::mutex m_mutex;
+  std::unordered_map<std::string, std::weak_ptr<const JSBigString>> m_strings;
+};
+
+} // namespace facebook::react
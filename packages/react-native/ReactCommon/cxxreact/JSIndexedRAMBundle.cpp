@@ -7,6 +7,7 @@
 
 #include "JSIndexedRAMBundle.h"
 
+#include <cxxreact/RAMBundleModuleCache.h>
 #include <glog/logging.h>
 #include <fstream>
 #include <memory>
@@ -28,6 +29,10 @@ JSIndexedRAMBundle::JSIndexedRAMBundle(const char* sourcePath) {
         "Bundle ", sourcePath, "cannot be opened: ", m_bundle->rdstate()));
   }
   init();
+
+  // The version key tells apart different builds of the bundle installed at
+  // the same path (e.g. after an OTA update), even within the same second.
+  m_cacheKey = JSBigFileString::versionKey(sourcePath);
 }
 
 JSIndexedRAMBundle::JSIndexedRAMBundle(
@@ -74,7 +79,17 @@ JSIndexedRAMBundle::Module JSIndexedRAMBundle::getModule(
     uint32_t moduleId) const {
   Module ret;
   ret.name = folly::to<std::string>(moduleId, ".js");
-  ret.code = getModuleCode(moduleId);
+  if (m_cacheKey.empty()) {
+    ret.code = getModuleCode(moduleId);
+    return ret;
+  }
+
+  auto& cache = RAMBundleModuleCache::shared();
+  ret.sharedCode = cache.getModuleCode(m_cacheKey, moduleId);
+  if (!ret.sharedCode) {
+    ret.sharedCode = getModuleSource(moduleId);
+    cache.setModuleCode(m_cacheKey, moduleId, ret.sharedCode);
+  }
   return ret;
 }
 
@@ -84,7 +99,8 @@ std::unique_ptr<const JSBigString> JSIndexedRAMBundle::getStartupCode() {
   return std::move(m_startupCode);
 }
 
-std::string JSIndexedRAMBundle::getModuleCode(const uint32_t id) const {
+const JSIndexedRAMBundle::ModuleData& JSIndexedRAMBundle::getModuleData(
+    const uint32_t id) const {
   const auto moduleData = id < m_table.numEntries ? &m_table.data[id] : nullptr;
 
   // entries without associated code have offset = 0 and length = 0
@@ -94,12 +110,31 @@ std::string JSIndexedRAMBundle::getModuleCode(const uint32_t id) const {
     throw std::ios_base::failure(
         folly::to<std::string>("Error loading module", id, "from RAM Bundle"));
   }
+  return *moduleData;
+}
+
+std::string JSIndexedRAMBundle::getModuleCode(const uint32_t id) const {
+  const auto& moduleData = getModuleData(id);
+  const uint32_t length = folly::Endian::little(moduleData.length);
 
   std::string ret(length - 1, '\0');
   readBundle(
       &ret.front(),
       length - 1,
-      m_baseOffset + folly::Endian::little(moduleData->offset));
+      m_baseOffset + folly::Endian::little(moduleData.offset));
+  return ret;
+}
+
+std::shared_ptr<const JSBigString> JSIndexedRAMBundle::getModuleSource(
+    const uint32_t id) const {
+  const auto& moduleData = getModuleData(id);
+  const uint32_t length = folly::Endian::little(moduleData.length);
+
+  auto ret = std::make_shared<JSBigBufferString>(length - 1);
+  readBundle(
+      ret->data(),
+      length - 1,
+      m_baseOffset + folly::Endian::little(moduleData.offset));
   return ret;
 }
 
@@ -9,6 +9,7 @@
 
 #include <istream>
 #include <memory>
+#include <string>
 
 #include <cxxreact/JSBigString.h>
 #include <cxxreact/JSModulesUnbundle.h>
@@ -24,7 +25,8 @@ class RN_EXPORT JSIndexedRAMBundle : public JSModulesUnbundle {
   static std::function<std::unique_ptr<JSModulesUnbundle>(std::string)>
   buildFactory();
 
-  // Throws std::runtime_error on failure.
+  // Throws std::runtime_error on failure. Modules of bundles loaded from a
+  // file are cached process-wide in RAMBundleModuleCache::shared().
   JSIndexedRAMBundle(const char* sourceURL);
   JSIndexedRAMBundle(std::unique_ptr<const JSBigString> script);
 
@@ -55,7 +57,9 @@ class RN_EXPORT JSIndexedRAMBundle : public JSModulesUnbundle {
   };
 
   void init();
+  const ModuleData& getModuleData(const uint32_t id) const;
   std::string getModuleCode(const uint32_t id) const;
+  std::shared_ptr<const JSBigString> getModuleSource(const uint32_t id) const;
   void readBundle(char* buffer, const std::streamsize bytes) const;
   void readBundle(
       char* buffer,
@@ -66,6 +70,9 @@ class RN_EXPORT JSIndexedRAMBundle : public JSModulesUnbundle {
   ModuleTable m_table;
   size_t m_baseOffset;
   std::unique_ptr<JSBigBufferString> m_startupCode;
+  // Identifies the bundle file contents in the module cache; empty if the
+  // bundle's modules are not cached.
+  std::string m_cacheKey;
 };
 
 } // namespace facebook::react
@@ -8,9 +8,11 @@
 #pragma once
 
 #include <cstdint>
+#include <memory>
 #include <stdexcept>
 #include <string>
 
+#include <cxxreact/JSBigString.h>
 #include <folly/Conv.h>
 
 namespace facebook::react {
@@ -34,6 +36,9 @@ class JSModulesUnbundle {
   struct Module {
     std::string name;
     std::string code;
+    // When set, holds the source instead of `code`. The string may be shared
+    // with other holders (see RAMBundleModuleCache) and must not be copied.
+    std::shared_ptr<const JSBigString> sharedCode;
   };
   JSModulesUnbundle() {}
   virtual ~JSModulesUnbundle() {}
@@ -91,9 +91,31 @@ std::vector<std::string> ModuleRegistry::moduleNames() {
   return names;
 }
 
-std::optional<ModuleConfig> ModuleRegistry::getConfig(const std::string& name) {
-  SystraceSection s("ModuleRegistry::getConfig", "module", name);
+ModuleMethodTable::ModuleMethodTable(
+    const std::vector<MethodDescriptor>& methods) {
+  nameEnds_.reserve(methods.size());
+  types_.reserve(methods.size());
+  for (const auto& descriptor : methods) {
+    names_ += descriptor.name;
+    nameEnds_.push_back(static_cast<uint32_t>(names_.size()));
+    // TODO: #10487027 compare tags instead of doing string comparison?
+    if (descriptor.type == "promise") {
+      types_.push_back('p');
+    } else if (descriptor.type == "sync") {
+      types_.push_back('s');
+    } else {
+      types_.push_back('a');
+    }
+  }
+  names_.shrink_to_fit();
+}
 
+std::string_view ModuleMethodTable::nameAt(size_t methodId) const {
+  auto begin = methodId == 0 ? 0 : nameEnds_[methodId - 1];
+  return std::string_view(names_).substr(begin, nameEnds_[methodId] - begin);
+}
+
+std::optional<size_t> ModuleRegistry::getModuleIndex(const std::string& name) {
   // Initialize modulesByName_
   if (modulesByName_.empty() && !modules_.empty()) {
     moduleNames();
@@ -134,15 +156,37 @@ std::optional<ModuleConfig> ModuleRegistry::getConfig(const std::string& name) {
 
   // If we've gotten this far, then we've signaled moduleJSRequireBeginningEnd
 
-  size_t index = it->second;
+  CHECK(it->second < modules_.size());
+  return it->second;
+}
 
-  CHECK(index < modules_.size());
-  NativeModule* module = modules_[index].get();
+const std::shared_ptr<const ModuleMethodTable>& ModuleRegistry::getMethodTable(
+    size_t index) {
+  if (methodTables_.size() < modules_.size()) {
+    methodTables_.resize(modules_.size());
+  }
 
-  // string name, object constants, array methodNames (methodId is index),
-  // [array promiseMethodIds], [array syncMethodIds]
-  folly::dynamic config = folly::dynamic::array(name);
+  auto& methodTable = methodTables_[index];
+  if (!methodTable) {
+    SystraceSection s_("ModuleRegistry::getMethods");
+    methodTable =
+        std::make_shared<const ModuleMethodTable>(modules_[index]->getMethods());
+  }
+  return methodTable;
+}
+
+std::optional<ModuleDescription> ModuleRegistry::getModuleDescription(
+    const std::string& name) {
+  SystraceSection s("ModuleRegistry::getModuleDescription", "module", name);
+
+  auto index = getModuleIndex(name);
+  if (!index) {
+    return std::nullopt;
+  }
+
+  NativeModule* module = modules_[*index].get();
 
+  folly::dynamic constants;
   {
     SystraceSection s_("ModuleRegistry::getConstants", "module", name);
     /**
@@ -151,44 +195,57 @@ std::optional<ModuleConfig> ModuleRegistry::getConfig(const std::string& name) {
      * event. The Module will be initialized when we invoke one of its
      * NativeModule methods.
      */
-    config.push_back(module->getConstants());
+    constants = module->getConstants();
   }
 
-  {
-    SystraceSection s_("ModuleRegistry::getMethods", "module", name);
-    std::vector<MethodDescriptor> methods = module->getMethods();
+  auto methods = getMethodTable(*index);
 
+  if (methods->size() == 0 && constants.empty()) {
+    // no constants or methods
+    return std::nullopt;
+  }
+
+  return ModuleDescription{*index, name, std::move(constants), methods};
+}
+
+std::optional<ModuleConfig> ModuleRegistry::getConfig(const std::string& name) {
+  SystraceSection s("ModuleRegistry::getConfig", "module", name);
+
+  auto description = getModuleDescription(name);
+  if (!description) {
+    return std::nullopt;
+  }
+
+  // string name, object constants, array methodNames (methodId is index),
+  // [array promiseMethodIds], [array syncMethodIds]
+  folly::dynamic config = folly::dynamic::array(
+      std::move(description->name), std::move(description->constants));
+
+  const auto& methods = *description->methods;
+  if (methods.size() > 0) {
     folly::dynamic methodNames = folly::dynamic::array;
     folly::dynamic promiseMethodIds = folly::dynamic::array;
     folly::dynamic syncMethodIds = folly::dynamic::array;
 
-    for (auto& descriptor : methods) {
-      // TODO: #10487027 compare tags instead of doing string comparison?
-      methodNames.push_back(std::move(descriptor.name));
-      if (descriptor.type == "promise") {
-        promiseMethodIds.push_back(methodNames.size() - 1);
-      } else if (descriptor.type == "sync") {
-        syncMethodIds.push_back(methodNames.size() - 1);
+    for (size_t methodId = 0; methodId < methods.size(); methodId++) {
+      methodNames.push_back(std::string(methods.nameAt(methodId)));
+      if (methods.isPromise(methodId)) {
+        promiseMethodIds.push_back(methodId);
+      } else if (methods.isSync(methodId)) {
+        syncMethodIds.push_back(methodId);
       }
     }
 
-    if (!methodNames.empty()) {
-      config.push_back(std::move(methodNames));
-      if (!promiseMethodIds.empty() || !syncMethodIds.empty()) {
-        config.push_back(std::move(promiseMethodIds));
-        if (!syncMethodIds.empty()) {
-          config.push_back(std::move(syncMethodIds));
-        }
+    config.push_back(std::move(methodNames));
+    if (!promiseMethodIds.empty() || !syncMethodIds.empty()) {
+      config.push_back(std::move(promiseMethodIds));
+      if (!syncMethodIds.empty()) {
+        config.push_back(std::move(syncMethodIds));
       }
     }
   }
 
-  if (config.size() == 2 && config[1].empty()) {
-    // no constants or methods
-    return std::nullopt;
-  } else {
-    return ModuleConfig{index, std::move(config)};
-  }
+  return ModuleConfig{description->index, std::move(config)};
 }
 
 std::string ModuleRegistry::getModuleName(unsigned int moduleId) {
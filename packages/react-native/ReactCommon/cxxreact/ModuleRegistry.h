@@ -8,6 +8,7 @@
 #pragma once
 
 #include <memory>
+#include <string_view>
 #include <unordered_set>
 #include <vector>
 
@@ -28,6 +29,41 @@ struct ModuleConfig {
   folly::dynamic config;
 };
 
+// Compact form of the methods a module exports to JS. Method names are stored
+// back to back in a single buffer, and the type of each method is a single
+// character: 'a' (async), 'p' (promise) or 's' (sync).
+class RN_EXPORT ModuleMethodTable {
+ public:
+  explicit ModuleMethodTable(const std::vector<MethodDescriptor>& methods);
+
+  size_t size() const {
+    return types_.size();
+  }
+
+  std::string_view nameAt(size_t methodId) const;
+
+  bool isPromise(size_t methodId) const {
+    return types_[methodId] == 'p';
+  }
+
+  bool isSync(size_t methodId) const {
+    return types_[methodId] == 's';
+  }
+
+ private:
+  std::string names_;
+  std::vector<uint32_t> nameEnds_;
+  std::string types_;
+};
+
+// Everything needed to expose a module to JS.
+struct ModuleDescription {
+  size_t index;
+  std::string name;
+  folly::dynamic constants;
+  std::shared_ptr<const ModuleMethodTable> methods;
+};
+
 class RN_EXPORT ModuleRegistry {
  public:
   // not implemented:
@@ -48,6 +84,12 @@ class RN_EXPORT ModuleRegistry {
 
   std::optional<ModuleConfig> getConfig(const std::string& name);
 
+  // Same as getConfig, but leaves the conversion of the method table to the
+  // caller. Only the constants are computed per call; method tables are
+  // computed once per module.
+  std::optional<ModuleDescription> getModuleDescription(
+      const std::string& name);
+
   void callNativeMethod(
       unsigned int moduleId,
       unsigned int methodId,
@@ -71,6 +113,13 @@ class RN_EXPORT ModuleRegistry {
   // is called after moduleNames
   void updateModuleNamesFromIndex(size_t size);
 
+  std::optional<size_t> getModuleIndex(const std::string& name);
+
+  const std::shared_ptr<const ModuleMethodTable>& getMethodTable(size_t index);
+
+  // Populated lazily. Indices match modules_.
+  std::vector<std::shared_ptr<const ModuleMethodTable>> methodTables_;
+
   // This is only populated if moduleNames() is called.  Values are indices into
   // modules_.
   std::unordered_map<std::string, size_t> modulesByName_;
@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "RAMBundleModuleCache.h"
+
+#include <folly/Conv.h>
+
+namespace facebook::react {
+
+RAMBundleModuleCache& RAMBundleModuleCache::shared() {
+  // Intentionally leaked: modules may be required while static destructors
+  // run.
+  static auto* cache = new RAMBundleModuleCache();
+  return *cache;
+}
+
+RAMBundleModuleCache::RAMBundleModuleCache(size_t capacityBytes)
+    : m_capacity(capacityBytes) {}
+
+std::string RAMBundleModuleCache::makeKey(
+    const std::string& bundleKey,
+    uint32_t moduleId) {
+  return folly::to<std::string>(bundleKey, '#', moduleId);
+}
+
+std::shared_ptr<const JSBigString> RAMBundleModuleCache::getModuleCode(
+    const std::string& bundleKey,
+    uint32_t moduleId) {
+  auto key = makeKey(bundleKey, moduleId);
+  std::scoped_lock lock(m_mutex);
+  auto it = m_entriesByKey.find(key);
+  if (it == m_entriesByKey.end()) {
+    m_stats.misses++;
+    return nullptr;
+  }
+  m_stats.hits++;
+  m_entries.splice(m_entries.begin(), m_entries, it->second);
+  return it->second->code;
+}
+
+void RAMBundleModuleCache::setModuleCode(
+    const std::string& bundleKey,
+    uint32_t moduleId,
+    std::shared_ptr<const JSBigString> code) {
+  if (!code) {
+    return;
+  }
+
+  auto key = makeKey(bundleKey, moduleId);
+  std::scoped_lock lock(m_mutex);
+  if (code->size() > m_capacity) {
+    return;
+  }
+
+  auto it = m_entriesByKey.find(key);
+  if (it != m_entriesByKey.end()) {
+    auto& entry = *it->second;
+    m_stats.bytes -= entry.code->size();
+    m_entriesByCode.erase(entry.code.get());
+    entry.code = std::move(code);
+    entry.runtimeKind.clear();
+    entry.prepared = nullptr;
+    m_entries.splice(m_entries.begin(), m_entries, it->second);
+  } else {
+    m_entries.push_front(Entry{key, std::move(code), {}, nullptr});
+    m_entriesByKey.emplace(std::move(key), m_entries.begin());
+  }
+
+  const auto& entry = m_entries.front();
+  m_entriesByCode[entry.code.get()] = m_entries.begin();
+  m_stats.bytes += entry.code->size();
+  evict();
+}
+
+std::shared_ptr<const jsi::PreparedJavaScript>
+RAMBundleModuleCache::getPreparedJavaScript(
+    const JSBigString& code,
+    const std::string& runtimeKind) {
+  std::scoped_lock lock(m_mutex);
+  auto it = m_entriesByCode.find(&code);
+  if (it == m_entriesByCode.end() || !it->second->prepared ||
+      it->second->runtimeKind != runtimeKind) {
+    m_stats.preparedMisses++;
+    return nullptr;
+  }
+  m_stats.preparedHits++;
+  return it->second->prepared;
+}
+
+void RAMBundleModuleCache::setPreparedJavaScript(
+    const JSBigString& code,
+    const std::string& runtimeKind,
+    std::shared_ptr<const jsi::PreparedJavaScript> prepared) {
+  std::scoped_lock lock(m_mutex);
+  auto it = m_entriesByCode.find(&code);
+  if (it == m_entriesByCode.end()) {
+    return;
+  }
+  it->second->runtimeKind = runtimeKind;
+  it->second->prepared = std::move(prepared);
+}
+
+bool RAMBundleModuleCache::cachesPreparedJavaScript() const {
+  std::scoped_lock lock(m_mutex);
+  return m_cachesPreparedJavaScript;
+}
+
+void RAMBundleModuleCache::setCachesPreparedJavaScript(bool enabled) {
+  std::scoped_lock lock(m_mutex);
+  m_cachesPreparedJavaScript = enabled;
+  if (!enabled) {
+    for (auto& entry : m_entries) {
+      entry.runtimeKind.clear();
+      entry.prepared = nullptr;
+    }
+  }
+}
+
+size_t RAMBundleModuleCache::getCapacity() const {
+  std::scoped_lock lock(m_mutex);
+  return m_capacity;
+}
+
+void RAMBundleModuleCache::setCapacity(size_t capacityBytes) {
+  std::scoped_lock lock(m_mutex);
+  m_capacity = capacityBytes;
+  evict();
+}
+
+RAMBundleModuleCache::Stats RAMBundleModuleCache::getStats() const {
+  std::scoped_lock lock(m_mutex);
+  auto stats = m_stats;
+  stats.entries = m_entries.size();
+  return stats;
+}
+
+void RAMBundleModuleCache::clear() {
+  std::scoped_lock lock(m_mutex);
+  m_entriesByCode.clear();
+  m_entriesByKey.clear();
+  m_entries.clear();
+  m_stats.bytes = 0;
+}
+
+void RAMBundleModuleCache::evict() {
+  while (m_stats.bytes > m_capacity && !m_entries.empty()) {
+    auto& entry = m_entries.back();
+    m_stats.bytes -= entry.code->size();
+    m_stats.evictions++;
+    m_entriesByCode.erase(entry.code.get());
+    m_entriesByKey.erase(entry.key);
+    m_entries.pop_back();
+  }
+}
+
+} // namespace facebook::react
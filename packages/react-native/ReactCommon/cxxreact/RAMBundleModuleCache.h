@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include <cxxreact/JSBigString.h>
+#include <jsi/jsi.h>
+
+#ifndef RN_EXPORT
+#define RN_EXPORT __attribute__((visibility("default")))
+#endif
+
+namespace facebook::react {
+
+// Process-wide, size-bounded LRU cache of RAM bundle module sources, keyed by
+// bundle and module id. Sources are handed out as refcounted JSBigStrings, so
+// every instance in the process (and every reload of the same instance)
+// shares a single copy of each module, and an evicted module stays valid for
+// as long as somebody still holds it. Optionally, a PreparedJavaScript handle
+// can be cached alongside each source. The class is thread-safe.
+class RN_EXPORT RAMBundleModuleCache {
+ public:
+  struct Stats {
+    size_t hits{0};
+    size_t misses{0};
+    size_t evictions{0};
+    size_t preparedHits{0};
+    size_t preparedMisses{0};
+    size_t entries{0};
+    size_t bytes{0};
+  };
+
+  static constexpr size_t DEFAULT_CAPACITY_BYTES = 8 * 1024 * 1024;
+
+  // Returns the cache shared by the whole process.
+  static RAMBundleModuleCache& shared();
+
+  explicit RAMBundleModuleCache(size_t capacityBytes = DEFAULT_CAPACITY_BYTES);
+
+  RAMBundleModuleCache(const RAMBundleModuleCache&) = delete;
+  RAMBundleModuleCache& operator=(const RAMBundleModuleCache&) = delete;
+
+  // Returns the cached source of the module, or nullptr (and counts a miss).
+  std::shared_ptr<const JSBigString> getModuleCode(
+      const std::string& bundleKey,
+      uint32_t moduleId);
+
+  // Caches the source of the module, evicting least recently used modules
+  // until the cache fits its capacity. Sources larger than the whole capacity
+  // are not cached.
+  void setModuleCode(
+      const std::string& bundleKey,
+      uint32_t moduleId,
+      std::shared_ptr<const JSBigString> code);
+
+  // Returns the PreparedJavaScript handle cached for a source previously
+  // returned by the cache, if it was prepared by a runtime of the same kind
+  // (as reported by `jsi::Runtime::description()`).
+  std::shared_ptr<const jsi::PreparedJavaScript> getPreparedJavaScript(
+      const JSBigString& code,
+      const std::string& runtimeKind);
+
+  // Attaches a PreparedJavaScript handle to a cached source. Does nothing if
+  // the source is not (or no longer) cached.
+  void setPreparedJavaScript(
+      const JSBigString& code,
+      const std::string& runtimeKind,
+      std::shared_ptr<const jsi::PreparedJavaScript> prepared);
+
+  // Whether callers should prepare scripts and store the handles in the
+  // cache. Disabled by default: for some runtimes preparing a script is not
+  // cheaper than evaluating it from source.
+  bool cachesPreparedJavaScript() const;
+  void setCachesPreparedJavaScript(bool enabled);
+
+  size_t getCapacity() const;
+  void setCapacity(size_t capacityBytes);
+
+  Stats getStats() const;
+  void clear();
+
+ private:
+  struct Entry {
+    std::string key;
+    std::shared_ptr<const JSBigString> code;
+    std::string runtimeKind;
+    std::shared_ptr<const jsi::PreparedJavaScript> prepared;
+  };
+
+  using Entries = std::list<Entry>;
+
+  static std::string makeKey(const std::string& bundleKey, uint32_t moduleId);
+
+  void evict();
+
+  mutable std::mutex m_mutex;
+  size_t m_capacity;
+  bool m_cachesPreparedJavaScript{false};
+  Stats m_stats;
+  // Most recently used first.
+  Entries m_entries;
+  std::unordered_map<std::string, Entries::iterator> m_entriesByKey;
+  std::unordered_map<const JSBigString*, Entries::iterator> m_entriesByCode;
+};
+
+} // namespace facebook::react
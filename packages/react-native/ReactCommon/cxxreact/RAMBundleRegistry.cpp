@@ -69,6 +69,7 @@ JSModulesUnbundle::Module RAMBundleRegistry::getModule(
   return {
       folly::to<std::string>("seg-", bundleId, '_', std::move(module.name)),
       std::move(module.code),
+      std::move(module.sharedCode),
   };
 }
 
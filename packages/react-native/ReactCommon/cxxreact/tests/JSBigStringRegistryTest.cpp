@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cxxreact/JSBigStringRegistry.h>
+#include <gtest/gtest.h>
+
+#include "TempFile.h"
+
+using namespace facebook::react;
+
+TEST(JSBigStringRegistry, SharesContentsOfSameFile) {
+  JSBigStringRegistry registry;
+  auto path = tempFileFromString("Hello, world");
+
+  auto first = registry.fromPath(path);
+  auto second = registry.fromPath(path);
+
+  ASSERT_EQ(first->size(), 12);
+  EXPECT_EQ(std::string(first->c_str(), first->size()), "Hello, world");
+  EXPECT_EQ(first->c_str(), second->c_str());
+  EXPECT_EQ(registry.size(), 1);
+
+  unlink(path.c_str());
+}
+
+TEST(JSBigStringRegistry, ReleasesUnusedContents) {
+  JSBigStringRegistry registry;
+  auto path = tempFileFromString("Hello, world");
+
+  auto first = registry.fromPath(path);
+  EXPECT_EQ(registry.size(), 1);
+  first.reset();
+  EXPECT_EQ(registry.size(), 0);
+
+  auto second = registry.fromPath(path);
+  EXPECT_EQ(std::string(second->c_str(), second->size()), "Hello, world");
+  EXPECT_EQ(registry.size(), 1);
+
+  unlink(path.c_str());
+}
+
+TEST(JSBigStringRegistry, DistinguishesChangedFiles) {
+  JSBigStringRegistry registry;
+  auto path = tempFileFromString("Hello, world");
+  auto first = registry.fromPath(path);
+
+  // Replace the file rather than writing to it: a mapping is only valid as
+  // long as its file is not modified.
+  auto replacement = tempFileFromString("Goodbye, world");
+  ASSERT_EQ(rename(replacement.c_str(), path.c_str()), 0);
+  auto second = registry.fromPath(path);
+
+  EXPECT_EQ(std::string(first->c_str(), first->size()), "Hello, world");
+  EXPECT_EQ(std::string(second->c_str(), second->size()), "Goodbye, world");
+  EXPECT_EQ(registry.size(), 2);
+
+  unlink(path.c_str());
+}
+
+TEST(JSBigStringRegistry, DistinguishesModificationsWithinASecond) {
+  JSBigStringRegistry registry;
+  auto path = tempFileFromString("Hello, world");
+
+  // Same inode and size, modified twice within the same second.
+  struct timespec times[2] = {{0, UTIME_OMIT}, {1000, 1}};
+  ASSERT_EQ(utimensat(AT_FDCWD, path.c_str(), times, 0), 0);
+  auto first = registry.fromPath(path);
+  times[1].tv_nsec = 2;
+  ASSERT_EQ(utimensat(AT_FDCWD, path.c_str(), times, 0), 0);
+  auto second = registry.fromPath(path);
+
+  EXPECT_NE(first->c_str(), second->c_str());
+  EXPECT_EQ(registry.size(), 2);
+
+  unlink(path.c_str());
+}
+
+TEST(JSBigStringRegistry, GetOrCreateCallsFactoryOnce) {
+  JSBigStringRegistry registry;
+  int calls = 0;
+  auto create = [&calls]() -> std::unique_ptr<const JSBigString> {
+    calls++;
+    auto str = std::make_unique<JSBigBufferString>(5);
+    memcpy(str->data(), "asset", 5);
+    return str;
+  };
+
+  auto first = registry.getOrCreate("asset:main.jsbundle", create);
+  auto second = registry.getOrCreate("asset:main.jsbundle", create);
+
+  EXPECT_EQ(calls, 1);
+  EXPECT_EQ(first->c_str(), second->c_str());
+}
+
+TEST(JSBigStringRegistry, SharesContentsCreatedConcurrently) {
+  JSBigStringRegistry registry;
+  auto create = []() -> std::unique_ptr<const JSBigString> {
+    return std::make_unique<JSBigStdString>("asset");
+  };
+
+  // The factory runs without the registry locked, so another caller can
+  // register the same contents in the meantime.
+  auto inner = std::unique_ptr<const JSBigString>{};
+  auto outer = registry.getOrCreate("asset:main.jsbundle", [&]() {
+    inner = registry.getOrCreate("asset:main.jsbundle", create);
+    return create();
+  });
+
+  EXPECT_EQ(outer->c_str(), inner->c_str());
+  EXPECT_EQ(registry.size(), 1);
+}
@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <cxxreact/ModuleRegistry.h>
+#include <cxxreact/NativeModule.h>
+#include <gtest/gtest.h>
+
+using namespace facebook::react;
+using dynamic = folly::dynamic;
+
+namespace {
+class TestNativeModule : public NativeModule {
+ public:
+  TestNativeModule(std::string name, dynamic constants, int* getMethodsCalls)
+      : name_(std::move(name)),
+        constants_(std::move(constants)),
+        getMethodsCalls_(getMethodsCalls) {}
+
+  std::string getName() override {
+    return name_;
+  }
+
+  std::string getSyncMethodName(unsigned int /*methodId*/) override {
+    return "syncMethod";
+  }
+
+  std::vector<MethodDescriptor> getMethods() override {
+    (*getMethodsCalls_)++;
+    return {
+        {"asyncMethod", "async"},
+        {"promiseMethod", "promise"},
+        {"syncMethod", "sync"},
+    };
+  }
+
+  dynamic getConstants() override {
+    return constants_;
+  }
+
+  void invoke(
+      unsigned int /*reactMethodId*/,
+      dynamic&& /*params*/,
+      int /*callId*/) override {}
+
+  MethodCallResult callSerializableNativeHook(
+      unsigned int /*reactMethodId*/,
+      dynamic&& /*args*/) override {
+    return std::nullopt;
+  }
+
+ private:
+  std::string name_;
+  dynamic constants_;
+  int* getMethodsCalls_;
+};
+} // namespace
+
+TEST(ModuleRegistry, GetConfig) {
+  int getMethodsCalls = 0;
+  std::vector<std::unique_ptr<NativeModule>> modules;
+  modules.push_back(std::make_unique<TestNativeModule>(
+      "RCTTest", dynamic::object("a", 1), &getMethodsCalls));
+  ModuleRegistry registry{std::move(modules)};
+
+  auto config = registry.getConfig("Test");
+  ASSERT_TRUE(config.has_value());
+  EXPECT_EQ(0, config->index);
+  EXPECT_EQ(
+      dynamic::array(
+          "Test",
+          dynamic::object("a", 1),
+          dynamic::array("asyncMethod", "promiseMethod", "syncMethod"),
+          dynamic::array(1),
+          dynamic::array(2)),
+      config->config);
+
+  EXPECT_FALSE(registry.getConfig("Unknown").has_value());
+}
+
+TEST(ModuleRegistry, MethodTablesAreComputedOnce) {
+  int getMethodsCalls = 0;
+  std::vector<std::unique_ptr<NativeModule>> modules;
+  modules.push_back(std::make_unique<TestNativeModule>(
+      "First", dynamic(), &getMethodsCalls));
+  modules.push_back(std::make_unique<TestNativeModule>(
+      "Second", dynamic(), &getMethodsCalls));
+  ModuleRegistry registry{std::move(modules)};
+
+  auto description = registry.getModuleDescription("Second");
+  registry.getModuleDescription("Second");
+  registry.getConfig("Second");
+  EXPECT_EQ(1, getMethodsCalls);
+
+  ASSERT_TRUE(description.has_value());
+  EXPECT_EQ(1, description->index);
+  const auto& methods = *description->methods;
+  ASSERT_EQ(3, methods.size());
+  EXPECT_EQ("promiseMethod", methods.nameAt(1));
+  EXPECT_TRUE(methods.isPromise(1));
+  EXPECT_EQ("syncMethod", methods.nameAt(2));
+  EXPECT_TRUE(methods.isSync(2));
+  EXPECT_FALSE(methods.isPromise(0) || methods.isSync(0));
+}
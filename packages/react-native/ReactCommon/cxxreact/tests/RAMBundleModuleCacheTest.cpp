@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <cxxreact/RAMBundleModuleCache.h>
+#include <gtest/gtest.h>
+
+using namespace facebook::react;
+
+namespace {
+std::shared_ptr<const JSBigString> makeCode(size_t size) {
+  return std::make_shared<JSBigStdString>(std::string(size, 'x'));
+}
+
+class TestPreparedJavaScript : public facebook::jsi::PreparedJavaScript {};
+} // namespace
+
+TEST(RAMBundleModuleCache, SharesCachedModules) {
+  RAMBundleModuleCache cache{100};
+
+  EXPECT_EQ(cache.getModuleCode("bundle", 1), nullptr);
+
+  auto code = makeCode(10);
+  cache.setModuleCode("bundle", 1, code);
+
+  EXPECT_EQ(cache.getModuleCode("bundle", 1), code);
+  EXPECT_EQ(cache.getModuleCode("other", 1), nullptr);
+
+  auto stats = cache.getStats();
+  EXPECT_EQ(stats.hits, 1);
+  EXPECT_EQ(stats.misses, 2);
+  EXPECT_EQ(stats.entries, 1);
+  EXPECT_EQ(stats.bytes, 10);
+}
+
+TEST(RAMBundleModuleCache, EvictsLeastRecentlyUsedModules) {
+  RAMBundleModuleCache cache{25};
+
+  cache.setModuleCode("bundle", 1, makeCode(10));
+  auto code = makeCode(10);
+  cache.setModuleCode("bundle", 2, code);
+  cache.getModuleCode("bundle", 1);
+  cache.setModuleCode("bundle", 3, makeCode(10));
+
+  EXPECT_NE(cache.getModuleCode("bundle", 1), nullptr);
+  EXPECT_EQ(cache.getModuleCode("bundle", 2), nullptr);
+  EXPECT_NE(cache.getModuleCode("bundle", 3), nullptr);
+  // Evicted modules stay valid for their holders.
+  EXPECT_EQ(code->size(), 10);
+
+  auto stats = cache.getStats();
+  EXPECT_EQ(stats.evictions, 1);
+  EXPECT_EQ(stats.entries, 2);
+  EXPECT_EQ(stats.bytes, 20);
+
+  // Modules larger than the whole cache are not cached.
+  cache.setModuleCode("bundle", 4, makeCode(30));
+  EXPECT_EQ(cache.getModuleCode("bundle", 4), nullptr);
+  EXPECT_EQ(cache.getStats().entries, 2);
+}
+
+TEST(RAMBundleModuleCache, CachesPreparedJavaScriptPerRuntimeKind) {
+  RAMBundleModuleCache cache{100};
+  auto code = makeCode(10);
+  auto prepared = std::make_shared<TestPreparedJavaScript>();
+
+  // Sources that are not cached do not get a prepared handle either.
+  cache.setPreparedJavaScript(*code, "runtime", prepared);
+  EXPECT_EQ(cache.getPreparedJavaScript(*code, "runtime"), nullptr);
+
+  cache.setModuleCode("bundle", 1, code);
+  cache.setPreparedJavaScript(*code, "runtime", prepared);
+  EXPECT_EQ(cache.getPreparedJavaScript(*code, "runtime"), prepared);
+  EXPECT_EQ(cache.getPreparedJavaScript(*code, "otherRuntime"), nullptr);
+
+  // Replacing the source drops the handle prepared from the old one.
+  cache.setModuleCode("bundle", 1, makeCode(10));
+  EXPECT_EQ(cache.getPreparedJavaScript(*code, "runtime"), nullptr);
+
+  auto stats = cache.getStats();
+  EXPECT_EQ(stats.preparedHits, 1);
+  EXPECT_EQ(stats.preparedMisses, 3);
+}
@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+namespace facebook::react {
+
+// Writes `contents` into a new file in $TMPDIR (or /tmp) and returns its path.
+inline std::string tempFileFromString(const std::string& contents) {
+  const char* tmpDir = getenv("TMPDIR");
+  if (tmpDir == nullptr)
+    tmpDir = "/tmp";
+  std::string tmp{tmpDir};
+  tmp += "/temp.XXXXXX";
+
+  std::vector<char> tmpBuf{tmp.begin(), tmp.end()};
+  tmpBuf.push_back('\0');
+
+  const int fd = mkstemp(tmpBuf.data());
+  write(fd, contents.c_str(), contents.size());
+  close(fd);
+
+  return tmpBuf.data();
+}
+
+// Like `tempFileFromString`, but returns a read-only descriptor of the file,
+// which is already unlinked.
+inline int openTempFileFromString(const std::string& contents) {
+  auto path = tempFileFromString(contents);
+  const int fd = open(path.c_str(), O_RDONLY);
+  unlink(path.c_str());
+  return fd;
+}
+
+} // namespace facebook::react
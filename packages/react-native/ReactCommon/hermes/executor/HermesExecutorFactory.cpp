@@ -191,6 +191,11 @@ void HermesExecutorFactory::setDebuggerName(const std::string& debuggerName) {
   debuggerName_ = debuggerName;
 }
 
+void HermesExecutorFactory::setNativeCallBatching(
+    JSIExecutor::NativeCallBatching batching) {
+  nativeCallBatching_ = batching;
+}
+
 std::unique_ptr<JSExecutor> HermesExecutorFactory::createJSExecutor(
     std::shared_ptr<ExecutorDelegate> delegate,
     std::shared_ptr<MessageQueueThread> jsQueue) {
@@ -229,13 +234,26 @@ std::unique_ptr<JSExecutor> HermesExecutorFactory::createJSExecutor(
           .getPropertyAsObject(*decoratedRuntime, "prototype");
   errorPrototype.setProperty(*decoratedRuntime, "jsEngine", "hermes");
 
-  return std::make_unique<HermesExecutor>(
+  auto executor = std::make_unique<HermesExecutor>(
       decoratedRuntime,
       delegate,
       jsQueue,
       timeoutInvoker_,
       runtimeInstaller_,
       hermesRuntimeRef);
+
+  if (nativeCallBatching_.window.count() != 0) {
+    executor->setNativeCallBatching(
+        nativeCallBatching_,
+        [jsQueue = std::weak_ptr<MessageQueueThread>(jsQueue)](
+            std::function<void()>&& work) {
+          if (auto queue = jsQueue.lock()) {
+            queue->runOnQueue(std::move(work));
+          }
+        });
+  }
+
+  return executor;
 }
 
 ::hermes::vm::RuntimeConfig HermesExecutorFactory::defaultRuntimeConfig() {
@@ -31,6 +31,11 @@ class HermesExecutorFactory : public JSExecutorFactory {
 
   void setDebuggerName(const std::string& debuggerName);
 
+  // Batches native module calls of the executors created from now on (see
+  // JSIExecutor::setNativeCallBatching). Held calls are flushed from the JS
+  // queue the executor is created with.
+  void setNativeCallBatching(JSIExecutor::NativeCallBatching batching);
+
   std::unique_ptr<JSExecutor> createJSExecutor(
       std::shared_ptr<ExecutorDelegate> delegate,
       std::shared_ptr<MessageQueueThread> jsQueue) override;
@@ -43,6 +48,7 @@ class HermesExecutorFactory : public JSExecutorFactory {
   ::hermes::vm::RuntimeConfig runtimeConfig_;
   bool enableDebugger_ = true;
   std::string debuggerName_ = "Hermes React Native";
+  JSIExecutor::NativeCallBatching nativeCallBatching_;
 };
 
 class HermesExecutor : public JSIExecutor {
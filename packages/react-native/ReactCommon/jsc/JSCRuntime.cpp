@@ -16,7 +16,9 @@
 #include <deque>
 #include <mutex>
 #include <sstream>
+#include <string_view>
 #include <thread>
+#include <unordered_map>
 
 namespace facebook {
 namespace jsc {
@@ -253,6 +255,7 @@ class JSCRuntime : public jsi::Runtime {
   jsi::Symbol createSymbol(JSValueRef symbolRef) const;
   jsi::String createString(JSStringRef stringRef) const;
   jsi::PropNameID createPropNameID(JSStringRef stringRef);
+  jsi::PropNameID createPropNameID(const char* str, size_t length);
   jsi::Object createObject(JSObjectRef objectRef) const;
 
   // Used by factory methods and clone methods
@@ -272,6 +275,19 @@ class JSCRuntime : public jsi::Runtime {
   std::string desc_;
   JSValueRef nativeStateSymbol_ = nullptr;
   std::deque<jsi::Function> microtaskQueue_;
+  // Property names created from ASCII/UTF-8 are interned: the same few names
+  // (props, module methods, UIManager calls) are created over and over again,
+  // and each of them would otherwise allocate and hash a fresh JSStringRef.
+  // The table holds a reference to each of its strings until the runtime is
+  // destroyed, so an interned JSStringRef stays stable.
+  struct PropNameHash {
+    using is_transparent = void;
+    size_t operator()(std::string_view name) const {
+      return std::hash<std::string_view>{}(name);
+    }
+  };
+  std::unordered_map<std::string, JSStringRef, PropNameHash, std::equal_to<>>
+      propNameTable_;
 #ifndef NDEBUG
   mutable std::atomic<intptr_t> objectCounter_;
   mutable std::atomic<intptr_t> symbolCounter_;
@@ -306,7 +322,30 @@ class JSCRuntime : public jsi::Runtime {
 
 // JSStringRef utilities
 namespace {
-std::string JSStringToSTLString(JSStringRef str) {
+// Writes str into out if it only contains ASCII characters, narrowing its
+// UTF-16 buffer directly instead of going through a UTF-8 conversion.
+bool JSStringToASCII(JSStringRef str, std::string& out) {
+  size_t length = JSStringGetLength(str);
+  const JSChar* chars = JSStringGetCharactersPtr(str);
+  for (size_t i = 0; i < length; i++) {
+    if (chars[i] >= 0x80) {
+      return false;
+    }
+  }
+  out.resize(length);
+  for (size_t i = 0; i < length; i++) {
+    out[i] = static_cast<char>(chars[i]);
+  }
+  return true;
+}
+
+// Writes str as UTF-8 into out, which callers can reuse across conversions.
+void JSStringToSTLString(JSStringRef str, std::string& out) {
+  // Property names and most other strings crossing JSI are ASCII.
+  if (JSStringToASCII(str, out)) {
+    return;
+  }
+
   // Small string optimization: Avoid one heap allocation for strings that fit
   // in stackBuffer.size() bytes of UTF-8 (including the null terminator).
   std::array<char, 20> stackBuffer;
@@ -331,9 +370,16 @@ std::string JSStringToSTLString(JSStringRef str) {
     // slower than if we knew the length (like below) but better than crashing.
     // TODO(T62295565): Perform a non-strict, best effort conversion of the
     // full string instead, like we did before the JSI migration.
-    return std::string(buffer);
+    out.assign(buffer);
+    return;
   }
-  return std::string(buffer, actualBytes - 1);
+  out.assign(buffer, actualBytes - 1);
+}
+
+std::string JSStringToSTLString(JSStringRef str) {
+  std::string result;
+  JSStringToSTLString(str, result);
+  return result;
 }
 
 JSStringRef getLengthString() {
@@ -399,6 +445,9 @@ JSCRuntime::~JSCRuntime() {
   // No need to unprotect nativeStateSymbol_ since the heap is getting torn down
   // anyway
   JSGlobalContextRelease(ctx_);
+  for (const auto& [name, strRef] : propNameTable_) {
+    JSStringRelease(strRef);
+  }
 #ifndef NDEBUG
   assert(
       objectCounter_ == 0 && "JSCRuntime destroyed with a dangling API object");
@@ -644,21 +693,13 @@ jsi::PropNameID JSCRuntime::createPropNameIDFromAscii(
     const char* str,
     size_t length) {
   // For system JSC this must is identical to a string
-  std::string tmp(str, length);
-  JSStringRef strRef = JSStringCreateWithUTF8CString(tmp.c_str());
-  auto res = createPropNameID(strRef);
-  JSStringRelease(strRef);
-  return res;
+  return createPropNameID(str, length);
 }
 
 jsi::PropNameID JSCRuntime::createPropNameIDFromUtf8(
     const uint8_t* utf8,
     size_t length) {
-  std::string tmp(reinterpret_cast<const char*>(utf8), length);
-  JSStringRef strRef = JSStringCreateWithUTF8CString(tmp.c_str());
-  auto res = createPropNameID(strRef);
-  JSStringRelease(strRef);
-  return res;
+  return createPropNameID(reinterpret_cast<const char*>(utf8), length);
 }
 
 jsi::PropNameID JSCRuntime::createPropNameIDFromString(const jsi::String& str) {
@@ -1462,6 +1503,33 @@ jsi::PropNameID JSCRuntime::createPropNameID(JSStringRef str) {
   return make<jsi::PropNameID>(makeStringValue(str));
 }
 
+namespace {
+// Long names are rarely reused, and the table must not grow without bound
+// when names are generated (e.g. from user data).
+constexpr size_t kMaxInternedPropNameLength = 64;
+constexpr size_t kMaxInternedPropNames = 1024;
+} // namespace
+
+jsi::PropNameID JSCRuntime::createPropNameID(const char* str, size_t length) {
+  // Looked up by view, so that hits don't allocate.
+  auto it = propNameTable_.find(std::string_view(str, length));
+  if (it != propNameTable_.end()) {
+    return createPropNameID(it->second);
+  }
+
+  std::string name(str, length);
+  JSStringRef strRef = JSStringCreateWithUTF8CString(name.c_str());
+  auto res = createPropNameID(strRef);
+  if (length <= kMaxInternedPropNameLength &&
+      propNameTable_.size() < kMaxInternedPropNames) {
+    // The table takes over our reference.
+    propNameTable_.emplace(std::move(name), strRef);
+  } else {
+    JSStringRelease(strRef);
+  }
+  return res;
+}
+
 jsi::Runtime::PointerValue* JSCRuntime::makeObjectValue(
     JSObjectRef objectRef) const {
   if (!objectRef) {
@@ -6,100 +6,131 @@
  */
 
 #include "JsErrorHandler.h"
+#include <folly/hash/Hash.h>
 #include <react/renderer/mapbuffer/MapBufferBuilder.h>
-#include <regex>
-#include <sstream>
 #include <string>
+#include <string_view>
 #include <vector>
+#include "StackTraceParser.h"
 
 namespace facebook::react {
 
 using facebook::react::JSErrorHandlerKey;
 
-static MapBuffer
-parseErrorStack(const jsi::JSError& error, bool isFatal, bool isHermes) {
-  /**
-   * This parses the different stack traces and puts them into one format
-   * This borrows heavily from TraceKit (https://github.com/occ/TraceKit)
-   * This is the same regex from stacktrace-parser.js.
-   */
-  const std::regex REGEX_CHROME(
-      R"(^\s*at (?:(?:(?:Anonymous function)?|((?:\[object object\])?\S+(?: \[as \S+\])?)) )?\(?((?:file|http|https):.*?):(\d+)(?::(\d+))?\)?\s*$)");
-  const std::regex REGEX_GECKO(
-      R"(^(?:\s*([^@]*)(?:\((.*?)\))?@)?(\S.*?):(\d+)(?::(\d+))?\s*$)");
-  const std::regex REGEX_NODE(
-      R"(^\s*at (?:((?:\[object object\])?\S+(?: \[as \S+\])?) )?\(?(.*?):(\d+)(?::(\d+))?\)?\s*$)");
-
-  // Capture groups for Hermes (from parseHermesStack.js):
-  // 1. function name
-  // 2. is this a native stack frame?
-  // 3. is this a bytecode address or a source location?
-  // 4. source URL (filename)
-  // 5. line number (1 based)
-  // 6. column number (1 based) or virtual offset (0 based)
-  const std::regex REGEX_HERMES(
-      R"(^ {4}at (.+?)(?: \((native)\)?| \((address at )?(.*?):(\d+):(\d+)\))$)");
-
-  std::string line;
-  std::stringstream strStream(error.getStack());
+namespace {
 
+// The least recently seen errors stop being tracked past this many.
+constexpr size_t kMaxTrackedErrors = 64;
+
+MapBuffer parseErrorStack(
+    std::string_view stack,
+    const std::string& message,
+    bool isFatal,
+    bool isHermes) {
   auto errorObj = MapBufferBuilder();
   std::vector<MapBuffer> frames;
 
-  while (std::getline(strStream, line, '\n')) {
+  for (const auto& parsed :
+       stacktraceparser::parseStackFrames(stack, isHermes)) {
     auto frame = MapBufferBuilder();
-    auto searchResults = std::smatch{};
-
-    if (isHermes) {
-      if (std::regex_search(line, searchResults, REGEX_HERMES)) {
-        std::string str2 = std::string(searchResults[2]);
-        if (str2.compare("native")) {
-          frame.putString(kFrameFileName, std::string(searchResults[4]));
-          frame.putString(kFrameMethodName, std::string(searchResults[1]));
-          frame.putInt(kFrameLineNumber, std::stoi(searchResults[5]));
-          frame.putInt(kFrameColumnNumber, std::stoi(searchResults[6]));
-          frames.push_back(frame.build());
-        }
-      }
-    } else {
-      if (std::regex_search(line, searchResults, REGEX_GECKO)) {
-        frame.putString(kFrameFileName, std::string(searchResults[3]));
-        frame.putString(kFrameMethodName, std::string(searchResults[1]));
-        frame.putInt(kFrameLineNumber, std::stoi(searchResults[4]));
-        frame.putInt(kFrameColumnNumber, std::stoi(searchResults[5]));
-      } else if (
-          std::regex_search(line, searchResults, REGEX_CHROME) ||
-          std::regex_search(line, searchResults, REGEX_NODE)) {
-        frame.putString(kFrameFileName, std::string(searchResults[2]));
-        frame.putString(kFrameMethodName, std::string(searchResults[1]));
-        frame.putInt(kFrameLineNumber, std::stoi(searchResults[3]));
-        frame.putInt(kFrameColumnNumber, std::stoi(searchResults[4]));
-      } else {
-        continue;
-      }
-      frames.push_back(frame.build());
-    }
+    frame.putString(kFrameFileName, std::string(parsed.fileName));
+    frame.putString(kFrameMethodName, std::string(parsed.methodName));
+    frame.putInt(kFrameLineNumber, parsed.lineNumber);
+    frame.putInt(kFrameColumnNumber, parsed.columnNumber);
+    frames.push_back(frame.build());
   }
   errorObj.putMapBufferList(kAllStackFrames, std::move(frames));
-  errorObj.putString(kErrorMessage, "EarlyJsError: " + error.getMessage());
+  errorObj.putString(kErrorMessage, "EarlyJsError: " + message);
   // TODO: If needed, can increment exceptionId by 1 each time
   errorObj.putInt(kExceptionId, 0);
   errorObj.putBool(kIsFatal, isFatal);
   return errorObj.build();
 }
 
+size_t hashError(const std::string& message, const std::string& stack) {
+  return folly::hash::hash_combine(message, stack);
+}
+
+template <typename TrackedErrors>
+auto findTrackedError(
+    TrackedErrors& trackedErrors,
+    const std::string& message,
+    const std::string& stack) {
+  auto hash = hashError(message, stack);
+  auto it = trackedErrors.begin();
+  for (; it != trackedErrors.end(); it++) {
+    // Distinct errors may share a hash, so the strings decide.
+    if (it->hash == hash && it->message == message && it->stack == stack) {
+      break;
+    }
+  }
+  return it;
+}
+
+} // namespace
+
 JsErrorHandler::JsErrorHandler(
-    JsErrorHandler::JsErrorHandlingFunc jsErrorHandlingFunc) {
+    JsErrorHandler::JsErrorHandlingFunc jsErrorHandlingFunc,
+    JsErrorHandler::ReportExecutor reportExecutor) {
   this->_jsErrorHandlingFunc = jsErrorHandlingFunc;
+  this->_reportExecutor = std::move(reportExecutor);
 };
 
 JsErrorHandler::~JsErrorHandler() {}
 
 void JsErrorHandler::handleJsError(const jsi::JSError& error, bool isFatal) {
+  {
+    std::scoped_lock lock(_mutex);
+    const auto& message = error.getMessage();
+    const auto& stack = error.getStack();
+    auto it = findTrackedError(_trackedErrors, message, stack);
+    if (it == _trackedErrors.end()) {
+      _trackedErrors.push_front({hashError(message, stack), message, stack, 1});
+      if (_trackedErrors.size() > kMaxTrackedErrors) {
+        _trackedErrors.pop_back();
+      }
+    } else {
+      // Most recently seen errors go first, so the stalest one is evicted.
+      _trackedErrors.splice(_trackedErrors.begin(), _trackedErrors, it);
+      it->count++;
+      if (!isFatal) {
+        _stats.duplicateErrors++;
+        return;
+      }
+    }
+    _stats.reportedErrors++;
+  }
+
   // TODO: Current error parsing works and is stable. Can investigate using
   // REGEX_HERMES to get additional Hermes data, though it requires JS setup.
-  MapBuffer errorMap = parseErrorStack(error, isFatal, false);
-  _jsErrorHandlingFunc(std::move(errorMap));
+
+  // A fatal error is about to tear the instance down, so it is reported
+  // before returning to the caller.
+  if (!_reportExecutor || isFatal) {
+    _jsErrorHandlingFunc(
+        parseErrorStack(error.getStack(), error.getMessage(), isFatal, false));
+    return;
+  }
+
+  _reportExecutor([jsErrorHandlingFunc = _jsErrorHandlingFunc,
+                   stack = error.getStack(),
+                   message = error.getMessage(),
+                   isFatal]() {
+    jsErrorHandlingFunc(parseErrorStack(stack, message, isFatal, false));
+  });
+}
+
+size_t JsErrorHandler::getErrorCount(
+    const std::string& message,
+    const std::string& stack) const {
+  std::scoped_lock lock(_mutex);
+  auto it = findTrackedError(_trackedErrors, message, stack);
+  return it == _trackedErrors.end() ? 0 : it->count;
+}
+
+JsErrorHandler::Stats JsErrorHandler::getStats() const {
+  std::scoped_lock lock(_mutex);
+  return _stats;
 }
 
 } // namespace facebook::react
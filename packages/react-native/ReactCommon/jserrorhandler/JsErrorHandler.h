@@ -9,6 +9,10 @@
 
 #include <jsi/jsi.h>
 #include <react/renderer/mapbuffer/MapBuffer.h>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <string>
 
 namespace facebook::react {
 
@@ -27,13 +31,59 @@ class JsErrorHandler {
  public:
   using JsErrorHandlingFunc = std::function<void(MapBuffer errorMap)>;
 
-  JsErrorHandler(JsErrorHandlingFunc jsErrorHandlingFunc);
+  /*
+   * Runs the given work off the JS thread. When provided, stack parsing,
+   * building the error map and calling `JsErrorHandlingFunc` for non-fatal
+   * errors happen there instead of on the thread reporting the error. Fatal
+   * errors are always reported synchronously.
+   */
+  using ReportExecutor = std::function<void(std::function<void()>&& work)>;
+
+  struct Stats {
+    // Errors handed to `JsErrorHandlingFunc`.
+    size_t reportedErrors{0};
+    // Non-fatal errors dropped because an identical one was already reported.
+    size_t duplicateErrors{0};
+  };
+
+  JsErrorHandler(
+      JsErrorHandlingFunc jsErrorHandlingFunc,
+      ReportExecutor reportExecutor = nullptr);
   ~JsErrorHandler();
 
+  /*
+   * Reports the error. A non-fatal error with the same message and stack as
+   * one that was already reported is only counted, so that an error thrown
+   * over and over again (e.g. by every item of a list) is parsed and reported
+   * once.
+   */
   void handleJsError(const jsi::JSError& error, bool isFatal);
 
+  /*
+   * Returns how many times an error with the given message and stack was
+   * handled, or 0 once it is no longer tracked.
+   */
+  size_t getErrorCount(const std::string& message, const std::string& stack)
+      const;
+
+  Stats getStats() const;
+
  private:
+  struct TrackedError {
+    size_t hash;
+    std::string message;
+    std::string stack;
+    size_t count;
+  };
+
   JsErrorHandlingFunc _jsErrorHandlingFunc;
+  ReportExecutor _reportExecutor;
+
+  mutable std::mutex _mutex;
+  // The most recently seen errors first; bounded, the least recently seen
+  // ones are dropped.
+  std::list<TrackedError> _trackedErrors;
+  Stats _stats;
 };
 
 } // namespace facebook::react
@@ -0,0 +1,233 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "StackTraceParser.h"
+
+#include <charconv>
+#include <optional>
+
+namespace facebook::react::stacktraceparser {
+
+/**
+ * This parses the different stack traces and puts them into one format.
+ * It used to be done with the regular expressions from stacktrace-parser.js
+ * (which borrows heavily from TraceKit, https://github.com/occ/TraceKit) and
+ * parseHermesStack.js; the functions below match the same lines with a single
+ * pass over each of them, without copying it.
+ */
+
+namespace {
+
+bool isSpace(char c) {
+  return c == ' ' || c == '\t' || c == '\r' || c == '\n' || c == '\f' ||
+      c == '\v';
+}
+
+bool isDigit(char c) {
+  return c >= '0' && c <= '9';
+}
+
+std::string_view trimLeft(std::string_view str) {
+  while (!str.empty() && isSpace(str.front())) {
+    str.remove_prefix(1);
+  }
+  return str;
+}
+
+std::string_view trimRight(std::string_view str) {
+  while (!str.empty() && isSpace(str.back())) {
+    str.remove_suffix(1);
+  }
+  return str;
+}
+
+bool consumePrefix(std::string_view& str, std::string_view prefix) {
+  if (str.substr(0, prefix.size()) != prefix) {
+    return false;
+  }
+  str.remove_prefix(prefix.size());
+  return true;
+}
+
+// Splits the trailing `:\d+` off `str`.
+std::optional<int> consumeTrailingNumber(std::string_view& str) {
+  size_t start = str.size();
+  while (start > 0 && isDigit(str[start - 1])) {
+    start--;
+  }
+  if (start == str.size() || start == 0 || str[start - 1] != ':') {
+    return std::nullopt;
+  }
+  int value = 0;
+  auto digits = str.substr(start);
+  auto result =
+      std::from_chars(digits.data(), digits.data() + digits.size(), value);
+  if (result.ec != std::errc{}) {
+    return std::nullopt;
+  }
+  str = str.substr(0, start - 1);
+  return value;
+}
+
+} // namespace
+
+bool parseLocation(
+    std::string_view str,
+    size_t minFileNameLength,
+    StackFrame& frame) {
+  auto rest = str;
+  auto last = consumeTrailingNumber(rest);
+  if (!last) {
+    return false;
+  }
+  auto withColumn = rest;
+  auto line = consumeTrailingNumber(withColumn);
+  if (line && withColumn.size() >= minFileNameLength) {
+    frame.fileName = withColumn;
+    frame.lineNumber = *line;
+    frame.columnNumber = *last;
+    return true;
+  }
+  if (rest.size() < minFileNameLength) {
+    return false;
+  }
+  frame.fileName = rest;
+  frame.lineNumber = *last;
+  frame.columnNumber = kUnknownColumnNumber;
+  return true;
+}
+
+// REGEX_GECKO:
+// ^(?:\s*([^@]*)(?:\((.*?)\))?@)?(\S.*?):(\d+)(?::(\d+))?\s*$
+bool parseGeckoFrame(std::string_view line, StackFrame& frame) {
+  line = trimRight(line);
+
+  auto parseTail = [&](std::string_view tail) {
+    return !tail.empty() && !isSpace(tail.front()) &&
+        parseLocation(tail, 1, frame);
+  };
+
+  auto at = line.find('@');
+  if (at != std::string_view::npos) {
+    if (parseTail(line.substr(at + 1))) {
+      frame.methodName = trimLeft(line.substr(0, at));
+      return true;
+    }
+  }
+
+  frame.methodName = {};
+  return parseTail(line);
+}
+
+// REGEX_CHROME:
+// ^\s*at (?:(?:(?:Anonymous function)?|((?:\[object object\])?\S+(?:
+// \[as \S+\])?)) )?\(?((?:file|http|https):.*?):(\d+)(?::(\d+))?\)?\s*$
+// REGEX_NODE:
+// ^\s*at (?:((?:\[object object\])?\S+(?: \[as \S+\])?) )?\(?(.*?):(\d+)
+// (?::(\d+))?\)?\s*$
+bool parseChromeOrNodeFrame(std::string_view line, StackFrame& frame) {
+  line = trimLeft(line);
+  if (!consumePrefix(line, "at ")) {
+    return false;
+  }
+  line = trimRight(line);
+  if (!line.empty() && line.back() == ')') {
+    line.remove_suffix(1);
+  }
+
+  auto parseTail = [&](std::string_view tail) {
+    consumePrefix(tail, "(");
+    return parseLocation(tail, 0, frame);
+  };
+
+  auto body = line;
+  if (consumePrefix(body, "Anonymous function ")) {
+    auto tail = body;
+    consumePrefix(tail, "(");
+    if ((tail.substr(0, 5) == "file:" || tail.substr(0, 5) == "http:" ||
+         tail.substr(0, 6) == "https:") &&
+        parseTail(body)) {
+      frame.methodName = {};
+      return true;
+    }
+  }
+
+  auto methodEnd = line.find(' ');
+  if (methodEnd != std::string_view::npos && methodEnd > 0) {
+    auto rest = line.substr(methodEnd + 1);
+    if (rest.substr(0, 4) == "[as ") {
+      auto aliasEnd = rest.find(']');
+      if (aliasEnd != std::string_view::npos && aliasEnd + 1 < rest.size() &&
+          rest[aliasEnd + 1] == ' ') {
+        methodEnd += 1 + aliasEnd + 1;
+        rest = rest.substr(aliasEnd + 2);
+      }
+    }
+    if (parseTail(rest)) {
+      frame.methodName = line.substr(0, methodEnd);
+      return true;
+    }
+  }
+
+  frame.methodName = {};
+  return parseTail(line);
+}
+
+// REGEX_HERMES:
+// ^ {4}at (.+?)(?: \((native)\)?| \((address at )?(.*?):(\d+):(\d+)\))$
+// Native frames are matched but not returned.
+bool parseHermesFrame(std::string_view line, StackFrame& frame) {
+  if (!consumePrefix(line, "    at ") || line.empty() || line.back() != ')') {
+    return false;
+  }
+
+  auto nameEnd = line.find(" (", 1);
+  if (nameEnd == std::string_view::npos) {
+    return false;
+  }
+  auto location = line.substr(nameEnd + 2);
+  location.remove_suffix(1);
+  if (location == "native") {
+    return false;
+  }
+  consumePrefix(location, "address at ");
+  auto rest = location;
+  auto column = consumeTrailingNumber(rest);
+  auto lineNumber = column ? consumeTrailingNumber(rest) : std::nullopt;
+  if (!lineNumber) {
+    return false;
+  }
+
+  frame.methodName = line.substr(0, nameEnd);
+  frame.fileName = rest;
+  frame.lineNumber = *lineNumber;
+  frame.columnNumber = *column;
+  return true;
+}
+
+std::vector<StackFrame> parseStackFrames(
+    std::string_view stack,
+    bool isHermes) {
+  std::vector<StackFrame> frames;
+  while (!stack.empty()) {
+    auto lineEnd = stack.find('\n');
+    auto line = stack.substr(0, lineEnd);
+    stack.remove_prefix(
+        lineEnd == std::string_view::npos ? stack.size() : lineEnd + 1);
+
+    auto frame = StackFrame{};
+    bool matched = isHermes
+        ? parseHermesFrame(line, frame)
+        : parseGeckoFrame(line, frame) || parseChromeOrNodeFrame(line, frame);
+    if (matched) {
+      frames.push_back(frame);
+    }
+  }
+  return frames;
+}
+
+} // namespace facebook::react::stacktraceparser
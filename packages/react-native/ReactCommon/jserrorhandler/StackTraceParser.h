@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <optional>
+#include <string_view>
+#include <vector>
+
+namespace facebook::react::stacktraceparser {
+
+// Reported when a frame has no column.
+constexpr int kUnknownColumnNumber = -1;
+
+/*
+ * A single frame of a stack trace; the strings point into the parsed line.
+ */
+struct StackFrame {
+  std::string_view fileName;
+  std::string_view methodName;
+  int lineNumber;
+  int columnNumber;
+};
+
+/*
+ * Matches `(.*?):(\d+)(?::(\d+))?` against the whole of `str`; the file name
+ * is as short as possible, so a trailing `:line:column` wins over `:line`.
+ * Returns false if it does not match or if the file name would be shorter than
+ * `minFileNameLength`.
+ */
+bool parseLocation(
+    std::string_view str,
+    size_t minFileNameLength,
+    StackFrame& frame);
+
+/*
+ * Each of these returns false if `line` is not a frame of the given format,
+ * in which case `frame` may be partially written.
+ */
+bool parseGeckoFrame(std::string_view line, StackFrame& frame);
+bool parseChromeOrNodeFrame(std::string_view line, StackFrame& frame);
+bool parseHermesFrame(std::string_view line, StackFrame& frame);
+
+/*
+ * Parses every line of `stack` and returns the frames in order; lines which
+ * are not frames (like the message) are skipped.
+ */
+std::vector<StackFrame> parseStackFrames(std::string_view stack, bool isHermes);
+
+} // namespace facebook::react::stacktraceparser
@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <hermes/hermes.h>
+#include <jserrorhandler/JsErrorHandler.h>
+#include <jsi/jsi.h>
+
+using namespace facebook;
+using namespace facebook::react;
+
+class JsErrorHandlerTest : public ::testing::Test {
+ protected:
+  JsErrorHandlerTest() : runtime_(hermes::makeHermesRuntime()) {}
+
+  std::unique_ptr<JsErrorHandler> makeHandler(bool withExecutor = false) {
+    auto reportExecutor = withExecutor
+        ? JsErrorHandler::ReportExecutor{[this](std::function<void()>&& work) {
+            scheduledWork_.push_back(std::move(work));
+          }}
+        : nullptr;
+    return std::make_unique<JsErrorHandler>(
+        [this](MapBuffer errorMap) { reports_.push_back(std::move(errorMap)); },
+        std::move(reportExecutor));
+  }
+
+  jsi::JSError error(const std::string& message, const std::string& stack) {
+    return jsi::JSError(*runtime_, message, stack);
+  }
+
+  static std::string stack(int line) {
+    return "Error\n    at foo (http://example.com/app.js:" +
+        std::to_string(line) + ":1)";
+  }
+
+  std::unique_ptr<jsi::Runtime> runtime_;
+  std::vector<MapBuffer> reports_;
+  std::vector<std::function<void()>> scheduledWork_;
+};
+
+TEST_F(JsErrorHandlerTest, errorsAreParsedAndReported) {
+  auto handler = makeHandler();
+
+  handler->handleJsError(error("oops", stack(42)), /* isFatal */ true);
+
+  ASSERT_EQ(reports_.size(), 1);
+  EXPECT_EQ(reports_[0].getString(kErrorMessage), "EarlyJsError: oops");
+  EXPECT_TRUE(reports_[0].getBool(kIsFatal));
+  auto frames = reports_[0].getMapBufferList(kAllStackFrames);
+  ASSERT_EQ(frames.size(), 1);
+  EXPECT_EQ(frames[0].getString(kFrameMethodName), "foo");
+  EXPECT_EQ(frames[0].getString(kFrameFileName), "http://example.com/app.js");
+  EXPECT_EQ(frames[0].getInt(kFrameLineNumber), 42);
+  EXPECT_EQ(frames[0].getInt(kFrameColumnNumber), 1);
+}
+
+TEST_F(JsErrorHandlerTest, duplicateNonFatalErrorsAreOnlyCounted) {
+  auto handler = makeHandler();
+
+  for (int i = 0; i < 3; i++) {
+    handler->handleJsError(error("oops", stack(1)), /* isFatal */ false);
+  }
+  handler->handleJsError(error("oops", stack(1)), /* isFatal */ true);
+
+  EXPECT_EQ(reports_.size(), 2);
+  EXPECT_EQ(handler->getErrorCount("oops", stack(1)), 4);
+  auto stats = handler->getStats();
+  EXPECT_EQ(stats.reportedErrors, 2);
+  EXPECT_EQ(stats.duplicateErrors, 2);
+}
+
+TEST_F(JsErrorHandlerTest, errorsDifferingInMessageOrStackAreReported) {
+  auto handler = makeHandler();
+
+  handler->handleJsError(error("oops", stack(1)), /* isFatal */ false);
+  handler->handleJsError(error("oops", stack(2)), /* isFatal */ false);
+  handler->handleJsError(error("oops!", stack(1)), /* isFatal */ false);
+
+  EXPECT_EQ(reports_.size(), 3);
+  EXPECT_EQ(handler->getErrorCount("oops", stack(1)), 1);
+  EXPECT_EQ(handler->getErrorCount("oops", stack(3)), 0);
+}
+
+TEST_F(JsErrorHandlerTest, leastRecentlySeenErrorsAreForgotten) {
+  auto handler = makeHandler();
+
+  // 64 distinct errors are tracked.
+  for (int line = 0; line < 64; line++) {
+    handler->handleJsError(error("oops", stack(line)), /* isFatal */ false);
+  }
+  // Seeing the first error again keeps it tracked...
+  handler->handleJsError(error("oops", stack(0)), /* isFatal */ false);
+  // ...so that a new error evicts the second one only.
+  handler->handleJsError(error("oops", stack(64)), /* isFatal */ false);
+
+  EXPECT_EQ(handler->getErrorCount("oops", stack(0)), 2);
+  EXPECT_EQ(handler->getErrorCount("oops", stack(1)), 0);
+  EXPECT_EQ(handler->getErrorCount("oops", stack(2)), 1);
+  EXPECT_EQ(handler->getErrorCount("oops", stack(64)), 1);
+
+  // An evicted error is reported again.
+  handler->handleJsError(error("oops", stack(1)), /* isFatal */ false);
+  EXPECT_EQ(reports_.size(), 66);
+}
+
+TEST_F(JsErrorHandlerTest, nonFatalErrorsAreReportedOnTheExecutor) {
+  auto handler = makeHandler(/* withExecutor */ true);
+
+  handler->handleJsError(error("oops", stack(1)), /* isFatal */ false);
+  EXPECT_TRUE(reports_.empty());
+  ASSERT_EQ(scheduledWork_.size(), 1);
+
+  scheduledWork_[0]();
+  ASSERT_EQ(reports_.size(), 1);
+  EXPECT_FALSE(reports_[0].getBool(kIsFatal));
+}
+
+TEST_F(JsErrorHandlerTest, fatalErrorsAreReportedSynchronously) {
+  auto handler = makeHandler(/* withExecutor */ true);
+
+  handler->handleJsError(error("oops", stack(1)), /* isFatal */ true);
+
+  EXPECT_TRUE(scheduledWork_.empty());
+  ASSERT_EQ(reports_.size(), 1);
+  EXPECT_TRUE(reports_[0].getBool(kIsFatal));
+}
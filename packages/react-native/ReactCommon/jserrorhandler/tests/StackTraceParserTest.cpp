@@ -0,0 +1,215 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <optional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <jserrorhandler/StackTraceParser.h>
+
+using namespace facebook::react::stacktraceparser;
+
+namespace {
+
+struct ExpectedFrame {
+  std::string methodName;
+  std::string fileName;
+  int lineNumber;
+  int columnNumber;
+
+  bool operator==(const ExpectedFrame& rhs) const = default;
+};
+
+std::ostream& operator<<(std::ostream& os, const ExpectedFrame& frame) {
+  return os << "{" << frame.methodName << ", " << frame.fileName << ", "
+            << frame.lineNumber << ", " << frame.columnNumber << "}";
+}
+
+using FrameParser = bool (*)(std::string_view, StackFrame&);
+
+std::optional<ExpectedFrame> parse(FrameParser parser, std::string_view line) {
+  auto frame = StackFrame{};
+  if (!parser(line, frame)) {
+    return std::nullopt;
+  }
+  return ExpectedFrame{
+      std::string(frame.methodName),
+      std::string(frame.fileName),
+      frame.lineNumber,
+      frame.columnNumber};
+}
+
+struct FrameTestCase {
+  std::string line;
+  std::optional<ExpectedFrame> expected;
+};
+
+constexpr auto kNoColumn = kUnknownColumnNumber;
+
+} // namespace
+
+TEST(StackTraceParserTest, geckoFrames) {
+  const std::vector<FrameTestCase> testCases = {
+      {"foo@http://example.com/app.js:10:20",
+       {{"foo", "http://example.com/app.js", 10, 20}}},
+      {"foo@http://example.com/app.js:10",
+       {{"foo", "http://example.com/app.js", 10, kNoColumn}}},
+      {"  foo/<@app.js:1:2  ", {{"foo/<", "app.js", 1, 2}}},
+      {"@app.js:1:2", {{"", "app.js", 1, 2}}},
+      {"app.js:1:2", {{"", "app.js", 1, 2}}},
+      {"foo bar@index.bundle?platform=ios:3:4",
+       {{"foo bar", "index.bundle?platform=ios", 3, 4}}},
+      // The file name is as short as possible.
+      {"foo@a:1:2:3", {{"foo", "a:1", 2, 3}}},
+      {"foo@app.js:x:1", {{"foo", "app.js:x", 1, kNoColumn}}},
+      {"foo@:1:2", {{"foo", ":1", 2, kNoColumn}}},
+      // Without a file name after `@`, the whole line is the file name.
+      {"foo@ app.js:1:2", {{"", "foo@ app.js", 1, 2}}},
+      // Malformed lines.
+      {"", std::nullopt},
+      {"Error: something went wrong", std::nullopt},
+      {"foo@app.js", std::nullopt},
+      {"foo@app.js:", std::nullopt},
+      {"foo@app.js:1:x", std::nullopt},
+      {"foo@ ", std::nullopt},
+      {"foo@app.js:99999999999", std::nullopt},
+  };
+
+  for (const auto& testCase : testCases) {
+    EXPECT_EQ(parse(parseGeckoFrame, testCase.line), testCase.expected)
+        << testCase.line;
+  }
+}
+
+TEST(StackTraceParserTest, chromeAndNodeFrames) {
+  const std::vector<FrameTestCase> testCases = {
+      // Chrome.
+      {"    at foo (http://example.com/app.js:10:20)",
+       {{"foo", "http://example.com/app.js", 10, 20}}},
+      {"    at http://example.com/app.js:10:20",
+       {{"", "http://example.com/app.js", 10, 20}}},
+      {"    at Anonymous function (file:///app.js:1:2)",
+       {{"", "file:///app.js", 1, 2}}},
+      {"    at Object.foo [as bar] (https://example.com/app.js:3:4)",
+       {{"Object.foo [as bar]", "https://example.com/app.js", 3, 4}}},
+      {"    at [object Object].foo (app.js:5:6)",
+       {{"[object", "Object].foo (app.js", 5, 6}}},
+      // Node.
+      {"    at foo (/usr/lib/app.js:10:20)",
+       {{"foo", "/usr/lib/app.js", 10, 20}}},
+      {"    at /usr/lib/app.js:10", {{"", "/usr/lib/app.js", 10, kNoColumn}}},
+      {"    at foo (app.js:10)", {{"foo", "app.js", 10, kNoColumn}}},
+      {"at foo (app.js:1:2)  ", {{"foo", "app.js", 1, 2}}},
+      // Malformed lines.
+      {"", std::nullopt},
+      {"Error: something went wrong", std::nullopt},
+      {"    at foo", std::nullopt},
+      {"    at foo (app.js)", std::nullopt},
+      {"    at foo (app.js:)", std::nullopt},
+      {"    foo (app.js:1:2)", std::nullopt},
+      {"    atfoo (app.js:1:2)", std::nullopt},
+  };
+
+  for (const auto& testCase : testCases) {
+    EXPECT_EQ(parse(parseChromeOrNodeFrame, testCase.line), testCase.expected)
+        << testCase.line;
+  }
+}
+
+TEST(StackTraceParserTest, hermesFrames) {
+  const std::vector<FrameTestCase> testCases = {
+      {"    at foo (index.bundle:10:20)", {{"foo", "index.bundle", 10, 20}}},
+      {"    at foo (address at index.bundle:1:2345)",
+       {{"foo", "index.bundle", 1, 2345}}},
+      {"    at Object.foo bar (http://localhost:8081/index.bundle:3:4)",
+       {{"Object.foo bar", "http://localhost:8081/index.bundle", 3, 4}}},
+      {"    at global (InternalBytecode.js:1:2)",
+       {{"global", "InternalBytecode.js", 1, 2}}},
+      // Native frames are not reported.
+      {"    at apply (native)", std::nullopt},
+      // Malformed lines.
+      {"", std::nullopt},
+      {"Error: something went wrong", std::nullopt},
+      {"  at foo (index.bundle:10:20)", std::nullopt},
+      {"    at foo (index.bundle:10)", std::nullopt},
+      {"    at foo (index.bundle:10:20", std::nullopt},
+      {"    at foo index.bundle:10:20)", std::nullopt},
+      {"    at  (index.bundle:10:20)", std::nullopt},
+  };
+
+  for (const auto& testCase : testCases) {
+    EXPECT_EQ(parse(parseHermesFrame, testCase.line), testCase.expected)
+        << testCase.line;
+  }
+}
+
+TEST(StackTraceParserTest, locations) {
+  struct LocationTestCase {
+    std::string str;
+    size_t minFileNameLength;
+    std::optional<ExpectedFrame> expected;
+  };
+
+  const std::vector<LocationTestCase> testCases = {
+      {"app.js:1:2", 0, {{"", "app.js", 1, 2}}},
+      {"app.js:1", 0, {{"", "app.js", 1, kNoColumn}}},
+      {":1:2", 0, {{"", "", 1, 2}}},
+      // A location with a column needs a file name of the minimal length;
+      // otherwise the line number becomes part of the file name.
+      {":1:2", 1, {{"", ":1", 2, kNoColumn}}},
+      {"a:1", 2, std::nullopt},
+      {"a:1:2:3", 0, {{"", "a:1", 2, 3}}},
+      {"app.js", 0, std::nullopt},
+      {"app.js:", 0, std::nullopt},
+      {"app.js:1:", 0, std::nullopt},
+      {"app.js:-1", 0, std::nullopt},
+      {"1", 0, std::nullopt},
+  };
+
+  for (const auto& testCase : testCases) {
+    auto frame = StackFrame{};
+    auto parsed = parseLocation(testCase.str, testCase.minFileNameLength, frame)
+        ? std::optional<ExpectedFrame>{ExpectedFrame{
+              "",
+              std::string(frame.fileName),
+              frame.lineNumber,
+              frame.columnNumber}}
+        : std::nullopt;
+    EXPECT_EQ(parsed, testCase.expected) << testCase.str;
+  }
+}
+
+TEST(StackTraceParserTest, stackFramesAreParsedInOrder) {
+  const auto chromeStack =
+      "TypeError: undefined is not a function\n"
+      "    at foo (http://example.com/app.js:1:2)\n"
+      "    at bar@http://example.com/app.js:3:4\n"
+      "\n"
+      "baz@app.js:5";
+  auto frames = parseStackFrames(chromeStack, /* isHermes */ false);
+  ASSERT_EQ(frames.size(), 3);
+  EXPECT_EQ(frames[0].methodName, "foo");
+  EXPECT_EQ(frames[1].methodName, "at bar");
+  EXPECT_EQ(frames[2].fileName, "app.js");
+  EXPECT_EQ(frames[2].lineNumber, 5);
+
+  const auto hermesStack =
+      "Error: oops\n"
+      "    at foo (index.bundle:1:2)\n"
+      "    at apply (native)\n"
+      "    at bar (address at index.bundle:3:4)\n";
+  frames = parseStackFrames(hermesStack, /* isHermes */ true);
+  ASSERT_EQ(frames.size(), 2);
+  EXPECT_EQ(frames[0].methodName, "foo");
+  EXPECT_EQ(frames[1].methodName, "bar");
+  EXPECT_EQ(frames[1].columnNumber, 4);
+
+  EXPECT_TRUE(parseStackFrames("", /* isHermes */ false).empty());
+}
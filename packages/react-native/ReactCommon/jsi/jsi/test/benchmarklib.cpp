@@ -0,0 +1,315 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <jsi/test/benchmarklib.h>
+
+#include <jsi/jsi.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+
+namespace facebook {
+namespace jsi {
+
+namespace {
+
+/// Runs the given number of operations.
+using BenchmarkBody = std::function<void(uint64_t operations)>;
+
+/// Prepares the state of a benchmark in `runtime`; setting up isn't measured.
+using BenchmarkSetup = std::function<BenchmarkBody(Runtime& runtime)>;
+
+struct Benchmark {
+  const char* name;
+  BenchmarkSetup setup;
+};
+
+/// Results are accumulated here so that operations aren't optimized away.
+volatile double benchmarkSink;
+
+class ConstantHostObject : public HostObject {
+ public:
+  Value get(Runtime& /*runtime*/, const PropNameID& /*name*/) override {
+    return Value(42.0);
+  }
+
+  void set(Runtime& /*runtime*/, const PropNameID& /*name*/, const Value&)
+      override {}
+};
+
+class VectorBuffer : public MutableBuffer {
+ public:
+  explicit VectorBuffer(size_t size) : data_(size) {}
+
+  size_t size() const override {
+    return data_.size();
+  }
+
+  uint8_t* data() override {
+    return data_.data();
+  }
+
+ private:
+  std::vector<uint8_t> data_;
+};
+
+class CounterState : public NativeState {
+ public:
+  double value{0};
+};
+
+constexpr size_t kArrayLength = 1024;
+
+std::vector<Benchmark> benchmarks() {
+  return {
+      {"propertyGetSet",
+       [](Runtime& rt) -> BenchmarkBody {
+         auto object = std::make_shared<Object>(rt);
+         auto name = std::make_shared<PropNameID>(
+             PropNameID::forAscii(rt, "value"));
+         return [&rt, object, name](uint64_t operations) {
+           double sum = 0;
+           for (uint64_t i = 0; i < operations; i++) {
+             object->setProperty(rt, *name, static_cast<double>(i));
+             sum += object->getProperty(rt, *name).getNumber();
+           }
+           benchmarkSink = sum;
+         };
+       }},
+      {"hostFunctionCall",
+       [](Runtime& rt) -> BenchmarkBody {
+         auto function = std::make_shared<Function>(
+             Function::createFromHostFunction(
+                 rt,
+                 PropNameID::forAscii(rt, "identity"),
+                 1,
+                 [](Runtime& /*rt*/,
+                    const Value& /*thisValue*/,
+                    const Value* args,
+                    size_t count) {
+                   return count > 0 ? Value(args[0].getNumber()) : Value();
+                 }));
+         return [&rt, function](uint64_t operations) {
+           double sum = 0;
+           for (uint64_t i = 0; i < operations; i++) {
+             sum += function->call(rt, static_cast<double>(i)).getNumber();
+           }
+           benchmarkSink = sum;
+         };
+       }},
+      {"hostObjectGet",
+       [](Runtime& rt) -> BenchmarkBody {
+         auto object = std::make_shared<Object>(Object::createFromHostObject(
+             rt, std::make_shared<ConstantHostObject>()));
+         auto name = std::make_shared<PropNameID>(
+             PropNameID::forAscii(rt, "value"));
+         return [&rt, object, name](uint64_t operations) {
+           double sum = 0;
+           for (uint64_t i = 0; i < operations; i++) {
+             sum += object->getProperty(rt, *name).getNumber();
+           }
+           benchmarkSink = sum;
+         };
+       }},
+      {"arrayIteration",
+       [](Runtime& rt) -> BenchmarkBody {
+         auto array = std::make_shared<Array>(rt, kArrayLength);
+         for (size_t i = 0; i < kArrayLength; i++) {
+           array->setValueAtIndex(rt, i, static_cast<double>(i));
+         }
+         // One operation reads one element.
+         return [&rt, array](uint64_t operations) {
+           double sum = 0;
+           uint64_t remaining = operations;
+           while (remaining > 0) {
+             auto length = std::min<uint64_t>(array->size(rt), remaining);
+             for (size_t i = 0; i < length; i++) {
+               sum += array->getValueAtIndex(rt, i).getNumber();
+             }
+             remaining -= length;
+           }
+           benchmarkSink = sum;
+         };
+       }},
+      {"stringRoundTrip",
+       [](Runtime& rt) -> BenchmarkBody {
+         return [&rt](uint64_t operations) {
+           double sum = 0;
+           for (uint64_t i = 0; i < operations; i++) {
+             auto str = String::createFromAscii(
+                 rt, "The quick brown fox jumps over the lazy dog");
+             sum += static_cast<double>(str.utf8(rt).size());
+           }
+           benchmarkSink = sum;
+         };
+       }},
+      {"arrayBufferAccess",
+       [](Runtime& rt) -> BenchmarkBody {
+         auto object = std::make_shared<Object>(
+             ArrayBuffer(rt, std::make_shared<VectorBuffer>(4096)));
+         return [&rt, object](uint64_t operations) {
+           double sum = 0;
+           for (uint64_t i = 0; i < operations; i++) {
+             auto arrayBuffer = object->getArrayBuffer(rt);
+             auto* data = arrayBuffer.data(rt);
+             sum += ++data[i % arrayBuffer.size(rt)];
+           }
+           benchmarkSink = sum;
+         };
+       }},
+      {"nativeStateLookup",
+       [](Runtime& rt) -> BenchmarkBody {
+         auto object = std::make_shared<Object>(rt);
+         object->setNativeState(rt, std::make_shared<CounterState>());
+         return [&rt, object](uint64_t operations) {
+           double sum = 0;
+           for (uint64_t i = 0; i < operations; i++) {
+             sum += object->getNativeState<CounterState>(rt)->value++;
+           }
+           benchmarkSink = sum;
+         };
+       }},
+  };
+}
+
+uint64_t measureNs(const BenchmarkBody& body, uint64_t operations) {
+  auto start = std::chrono::steady_clock::now();
+  body(operations);
+  auto end = std::chrono::steady_clock::now();
+  return static_cast<uint64_t>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(end - start)
+          .count());
+}
+
+bool matches(const std::string& name, const std::string& filter) {
+  return filter.empty() || name.find(filter) != std::string::npos;
+}
+
+void writeJsonString(std::ostream& os, const std::string& str) {
+  os << '"';
+  for (char c : str) {
+    if (c == '"' || c == '\\') {
+      os << '\\' << c;
+    } else if (static_cast<unsigned char>(c) < 0x20) {
+      os << "\\u" << std::hex << std::setw(4) << std::setfill('0')
+         << static_cast<int>(c) << std::dec << std::setfill(' ');
+    } else {
+      os << c;
+    }
+  }
+  os << '"';
+}
+
+bool parseNumberFlag(const char* arg, const char* flag, uint64_t& value) {
+  auto length = std::strlen(flag);
+  if (std::strncmp(arg, flag, length) != 0) {
+    return false;
+  }
+  char* end = nullptr;
+  value = std::strtoull(arg + length, &end, 10);
+  return end != arg + length && *end == '\0';
+}
+
+} // namespace
+
+std::vector<BenchmarkResult> runBenchmarks(
+    const std::vector<NamedRuntimeFactory>& runtimes,
+    const BenchmarkOptions& options) {
+  std::vector<BenchmarkResult> results;
+  auto minSampleTimeNs = options.minSampleTimeMs * 1000 * 1000;
+
+  for (const auto& runtimeFactory : runtimes) {
+    for (const auto& benchmark : benchmarks()) {
+      auto fullName = runtimeFactory.first + "/" + benchmark.name;
+      if (!matches(fullName, options.filter)) {
+        continue;
+      }
+
+      try {
+        auto runtime = runtimeFactory.second();
+        auto body = benchmark.setup(*runtime);
+
+        // Warm up, while finding how many operations a sample needs.
+        uint64_t operations = 1;
+        while (measureNs(body, operations) < minSampleTimeNs &&
+               operations < (uint64_t{1} << 32)) {
+          operations *= 2;
+        }
+
+        std::vector<double> nsPerOperation;
+        for (size_t i = 0; i < std::max<size_t>(options.samples, 1); i++) {
+          nsPerOperation.push_back(
+              static_cast<double>(measureNs(body, operations)) / operations);
+        }
+        std::sort(nsPerOperation.begin(), nsPerOperation.end());
+
+        results.push_back(BenchmarkResult{
+            runtimeFactory.first,
+            benchmark.name,
+            operations,
+            nsPerOperation[nsPerOperation.size() / 2],
+            nsPerOperation.front()});
+      } catch (const JSIException& e) {
+        std::cerr << fullName << " failed: " << e.what() << std::endl;
+      }
+    }
+  }
+  return results;
+}
+
+void writeBenchmarkResults(
+    std::ostream& os,
+    const std::vector<BenchmarkResult>& results) {
+  auto flags = os.flags();
+  os << std::fixed << std::setprecision(3);
+  os << "{\n  \"version\": 1,\n  \"results\": [";
+  for (size_t i = 0; i < results.size(); i++) {
+    const auto& result = results[i];
+    os << (i == 0 ? "\n" : ",\n") << "    {\"runtime\": ";
+    writeJsonString(os, result.runtime);
+    os << ", \"benchmark\": ";
+    writeJsonString(os, result.benchmark);
+    os << ", \"operations\": " << result.operations
+       << ", \"medianNsPerOperation\": " << result.medianNsPerOperation
+       << ", \"minNsPerOperation\": " << result.minNsPerOperation << "}";
+  }
+  os << (results.empty() ? "]\n}\n" : "\n  ]\n}\n");
+  os.flags(flags);
+}
+
+int benchmarkMain(
+    int argc,
+    char** argv,
+    const std::vector<NamedRuntimeFactory>& runtimes) {
+  BenchmarkOptions options;
+  for (int i = 1; i < argc; i++) {
+    uint64_t value = 0;
+    if (std::strncmp(argv[i], "--filter=", 9) == 0) {
+      options.filter = argv[i] + 9;
+    } else if (parseNumberFlag(argv[i], "--min-time-ms=", value)) {
+      options.minSampleTimeMs = value;
+    } else if (parseNumberFlag(argv[i], "--samples=", value)) {
+      options.samples = static_cast<size_t>(value);
+    } else {
+      std::cerr << "Usage: " << argv[0]
+                << " [--filter=<runtime/benchmark substring>]"
+                   " [--min-time-ms=<n>] [--samples=<n>]"
+                << std::endl;
+      return 1;
+    }
+  }
+
+  writeBenchmarkResults(std::cout, runBenchmarks(runtimes, options));
+  return 0;
+}
+
+} // namespace jsi
+} // namespace facebook
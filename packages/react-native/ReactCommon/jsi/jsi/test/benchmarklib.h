@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <jsi/jsi.h>
+
+namespace facebook {
+namespace jsi {
+
+class Runtime;
+
+using RuntimeFactory = std::function<std::unique_ptr<Runtime>()>;
+
+/// A runtime to benchmark, and the name it is reported under.
+using NamedRuntimeFactory = std::pair<std::string, RuntimeFactory>;
+
+struct BenchmarkOptions {
+  /// Only benchmarks and runtimes whose name contains this string run.
+  std::string filter;
+  /// Minimum duration of each sample.
+  uint64_t minSampleTimeMs{50};
+  /// Number of samples taken after a warm up one.
+  size_t samples{5};
+};
+
+struct BenchmarkResult {
+  std::string runtime;
+  std::string benchmark;
+  /// Operations per sample.
+  uint64_t operations;
+  double medianNsPerOperation;
+  double minNsPerOperation;
+};
+
+/// Runs the standard mixes of JSI operations (property access with
+/// `PropNameID`s, host function calls, host object access, array iteration,
+/// string conversions, `ArrayBuffer` access and `NativeState` lookups) against
+/// every runtime. The mixes only use the JSI API, so they run against any
+/// runtime, including ones that cannot evaluate JavaScript.
+std::vector<BenchmarkResult> runBenchmarks(
+    const std::vector<NamedRuntimeFactory>& runtimes,
+    const BenchmarkOptions& options);
+
+/// Writes results as JSON, in a format stable across versions (fields are
+/// only ever added): {"version": 1, "results": [{"runtime": ...,
+/// "benchmark": ..., "operations": ..., "medianNsPerOperation": ...,
+/// "minNsPerOperation": ...}, ...]}.
+void writeBenchmarkResults(
+    std::ostream& os,
+    const std::vector<BenchmarkResult>& results);
+
+/// Entry point of benchmark binaries: parses `--filter=`, `--min-time-ms=`
+/// and `--samples=`, and writes the results to stdout.
+int benchmarkMain(
+    int argc,
+    char** argv,
+    const std::vector<NamedRuntimeFactory>& runtimes);
+
+} // namespace jsi
+} // namespace facebook
@@ -0,0 +1,25 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <jsi/test/benchmarklib.h>
+#include <jsi/test/stubruntime.h>
+
+#ifdef JSI_BENCHMARK_JSC
+#include <JSCRuntime.h>
+#endif
+
+using namespace facebook::jsi;
+
+int main(int argc, char** argv) {
+  std::vector<NamedRuntimeFactory> runtimes{
+      {"stub", []() { return makeStubRuntime(); }},
+#ifdef JSI_BENCHMARK_JSC
+      {"jsc", []() { return facebook::jsc::makeJSCRuntime(); }},
+#endif
+  };
+  return benchmarkMain(argc, argv, runtimes);
+}
@@ -0,0 +1,514 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <jsi/test/stubruntime.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace facebook {
+namespace jsi {
+
+namespace {
+
+class StubRuntime : public Runtime {
+ private:
+  /// Reference counted: cloning a pointer shares the value.
+  class StubPointerValue : public PointerValue {
+   public:
+    StubPointerValue* retain() {
+      refCount_++;
+      return this;
+    }
+
+    void invalidate() override {
+      if (--refCount_ == 0) {
+        delete this;
+      }
+    }
+
+   private:
+    size_t refCount_{1};
+  };
+
+  /// Strings, property names and symbols (whose `str` is their description).
+  class StubString : public StubPointerValue {
+   public:
+    explicit StubString(std::string str) : str(std::move(str)) {}
+
+    std::string str;
+  };
+
+  class StubBigInt : public StubPointerValue {
+   public:
+    StubBigInt(uint64_t bits, bool isSigned)
+        : bits(bits), isSigned(isSigned) {}
+
+    uint64_t bits;
+    bool isSigned;
+  };
+
+  class StubObject : public StubPointerValue {
+   public:
+    enum class Kind { Plain, Array, ArrayBuffer, HostObject, HostFunction };
+
+    explicit StubObject(Kind kind) : kind(kind) {}
+
+    Kind kind;
+    std::unordered_map<std::string, Value> properties;
+    std::vector<Value> elements;
+    std::shared_ptr<MutableBuffer> buffer;
+    std::shared_ptr<HostObject> hostObject;
+    HostFunctionType hostFunction;
+    std::shared_ptr<NativeState> nativeState;
+  };
+
+ public:
+  StubRuntime() : global_(createObject()) {}
+
+  Value evaluateJavaScript(
+      const std::shared_ptr<const Buffer>& /*buffer*/,
+      const std::string& /*sourceURL*/) override {
+    throw JSINativeException("StubRuntime cannot evaluate JavaScript");
+  }
+
+  std::shared_ptr<const PreparedJavaScript> prepareJavaScript(
+      const std::shared_ptr<const Buffer>& /*buffer*/,
+      std::string /*sourceURL*/) override {
+    throw JSINativeException("StubRuntime cannot evaluate JavaScript");
+  }
+
+  Value evaluatePreparedJavaScript(
+      const std::shared_ptr<const PreparedJavaScript>& /*js*/) override {
+    throw JSINativeException("StubRuntime cannot evaluate JavaScript");
+  }
+
+  void queueMicrotask(const Function& callback) override {
+    microtasks_.emplace_back(Value(*this, callback).getObject(*this));
+  }
+
+  bool drainMicrotasks(int /*maxMicrotasksHint*/) override {
+    while (!microtasks_.empty()) {
+      auto callback = std::move(microtasks_.front());
+      microtasks_.pop_front();
+      callback.asFunction(*this).call(*this);
+    }
+    return true;
+  }
+
+  Object global() override {
+    return Value(*this, global_).getObject(*this);
+  }
+
+  std::string description() override {
+    return "StubRuntime";
+  }
+
+  bool isInspectable() override {
+    return false;
+  }
+
+ protected:
+  PointerValue* cloneSymbol(const PointerValue* pv) override {
+    return retain(pv);
+  }
+
+  PointerValue* cloneBigInt(const PointerValue* pv) override {
+    return retain(pv);
+  }
+
+  PointerValue* cloneString(const PointerValue* pv) override {
+    return retain(pv);
+  }
+
+  PointerValue* cloneObject(const PointerValue* pv) override {
+    return retain(pv);
+  }
+
+  PointerValue* clonePropNameID(const PointerValue* pv) override {
+    return retain(pv);
+  }
+
+  PropNameID createPropNameIDFromAscii(const char* str, size_t length)
+      override {
+    return make<PropNameID>(new StubString(std::string(str, length)));
+  }
+
+  PropNameID createPropNameIDFromUtf8(const uint8_t* utf8, size_t length)
+      override {
+    return make<PropNameID>(new StubString(
+        std::string(reinterpret_cast<const char*>(utf8), length)));
+  }
+
+  PropNameID createPropNameIDFromString(const String& str) override {
+    return make<PropNameID>(new StubString(string(str)));
+  }
+
+  PropNameID createPropNameIDFromSymbol(const Symbol& sym) override {
+    return make<PropNameID>(new StubString(string(sym)));
+  }
+
+  std::string utf8(const PropNameID& name) override {
+    return string(name);
+  }
+
+  bool compare(const PropNameID& a, const PropNameID& b) override {
+    return string(a) == string(b);
+  }
+
+  std::string symbolToString(const Symbol& sym) override {
+    return "Symbol(" + string(sym) + ")";
+  }
+
+  BigInt createBigIntFromInt64(int64_t value) override {
+    return make<BigInt>(new StubBigInt(static_cast<uint64_t>(value), true));
+  }
+
+  BigInt createBigIntFromUint64(uint64_t value) override {
+    return make<BigInt>(new StubBigInt(value, false));
+  }
+
+  bool bigintIsInt64(const BigInt& bigint) override {
+    auto& value = get<StubBigInt>(bigint);
+    return value.isSigned ||
+        value.bits <=
+        static_cast<uint64_t>(std::numeric_limits<int64_t>::max());
+  }
+
+  bool bigintIsUint64(const BigInt& bigint) override {
+    auto& value = get<StubBigInt>(bigint);
+    return !value.isSigned || static_cast<int64_t>(value.bits) >= 0;
+  }
+
+  uint64_t truncate(const BigInt& bigint) override {
+    return get<StubBigInt>(bigint).bits;
+  }
+
+  String bigintToString(const BigInt& bigint, int radix) override {
+    if (radix < 2 || radix > 36) {
+      throw JSINativeException("Invalid radix " + std::to_string(radix));
+    }
+    auto& value = get<StubBigInt>(bigint);
+    bool negative = value.isSigned && static_cast<int64_t>(value.bits) < 0;
+    uint64_t magnitude = negative ? ~value.bits + 1 : value.bits;
+    std::string digits;
+    do {
+      digits.push_back(
+          "0123456789abcdefghijklmnopqrstuvwxyz"[magnitude % radix]);
+      magnitude /= radix;
+    } while (magnitude != 0);
+    if (negative) {
+      digits.push_back('-');
+    }
+    std::reverse(digits.begin(), digits.end());
+    return make<String>(new StubString(std::move(digits)));
+  }
+
+  String createStringFromAscii(const char* str, size_t length) override {
+    return make<String>(new StubString(std::string(str, length)));
+  }
+
+  String createStringFromUtf8(const uint8_t* utf8, size_t length) override {
+    return make<String>(new StubString(
+        std::string(reinterpret_cast<const char*>(utf8), length)));
+  }
+
+  std::string utf8(const String& str) override {
+    return string(str);
+  }
+
+  Object createObject() override {
+    return make<Object>(new StubObject(StubObject::Kind::Plain));
+  }
+
+  Object createObject(std::shared_ptr<HostObject> ho) override {
+    auto object = new StubObject(StubObject::Kind::HostObject);
+    object->hostObject = std::move(ho);
+    return make<Object>(object);
+  }
+
+  std::shared_ptr<HostObject> getHostObject(const Object& object) override {
+    return get<StubObject>(object).hostObject;
+  }
+
+  HostFunctionType& getHostFunction(const Function& function) override {
+    return get<StubObject>(function).hostFunction;
+  }
+
+  bool hasNativeState(const Object& object) override {
+    return get<StubObject>(object).nativeState != nullptr;
+  }
+
+  std::shared_ptr<NativeState> getNativeState(const Object& object) override {
+    return get<StubObject>(object).nativeState;
+  }
+
+  void setNativeState(const Object& object, std::shared_ptr<NativeState> state)
+      override {
+    get<StubObject>(object).nativeState = std::move(state);
+  }
+
+  Value getProperty(const Object& object, const PropNameID& name) override {
+    auto& value = get<StubObject>(object);
+    if (value.hostObject) {
+      return value.hostObject->get(*this, name);
+    }
+    return getOwnProperty(value, string(name));
+  }
+
+  Value getProperty(const Object& object, const String& name) override {
+    auto& value = get<StubObject>(object);
+    if (value.hostObject) {
+      return value.hostObject->get(*this, PropNameID::forString(*this, name));
+    }
+    return getOwnProperty(value, string(name));
+  }
+
+  bool hasProperty(const Object& object, const PropNameID& name) override {
+    auto& value = get<StubObject>(object);
+    return value.properties.find(string(name)) != value.properties.end();
+  }
+
+  bool hasProperty(const Object& object, const String& name) override {
+    auto& value = get<StubObject>(object);
+    return value.properties.find(string(name)) != value.properties.end();
+  }
+
+  void setPropertyValue(
+      const Object& object,
+      const PropNameID& name,
+      const Value& value) override {
+    auto& target = get<StubObject>(object);
+    if (target.hostObject) {
+      target.hostObject->set(*this, name, value);
+      return;
+    }
+    setOwnProperty(target, string(name), value);
+  }
+
+  void setPropertyValue(
+      const Object& object,
+      const String& name,
+      const Value& value) override {
+    auto& target = get<StubObject>(object);
+    if (target.hostObject) {
+      target.hostObject->set(*this, PropNameID::forString(*this, name), value);
+      return;
+    }
+    setOwnProperty(target, string(name), value);
+  }
+
+  bool isArray(const Object& object) const override {
+    return get<StubObject>(object).kind == StubObject::Kind::Array;
+  }
+
+  bool isArrayBuffer(const Object& object) const override {
+    return get<StubObject>(object).kind == StubObject::Kind::ArrayBuffer;
+  }
+
+  bool isFunction(const Object& object) const override {
+    return get<StubObject>(object).kind == StubObject::Kind::HostFunction;
+  }
+
+  bool isHostObject(const Object& object) const override {
+    return get<StubObject>(object).kind == StubObject::Kind::HostObject;
+  }
+
+  bool isHostFunction(const Function& function) const override {
+    return isFunction(function);
+  }
+
+  Array getPropertyNames(const Object& object) override {
+    auto& value = get<StubObject>(object);
+    std::vector<std::string> names;
+    if (value.hostObject) {
+      for (auto& name : value.hostObject->getPropertyNames(*this)) {
+        names.push_back(name.utf8(*this));
+      }
+    } else {
+      for (auto& property : value.properties) {
+        names.push_back(property.first);
+      }
+    }
+    auto array = createArray(names.size());
+    for (size_t i = 0; i < names.size(); i++) {
+      array.setValueAtIndex(
+          *this, i, String::createFromUtf8(*this, names[i]));
+    }
+    return array;
+  }
+
+  // Weak objects are strong: the stub has no garbage collector.
+  WeakObject createWeakObject(const Object& object) override {
+    return make<WeakObject>(retain(getPointerValue(object)));
+  }
+
+  Value lockWeakObject(const WeakObject& weakObject) override {
+    return Value(make<Object>(retain(getPointerValue(weakObject))));
+  }
+
+  Array createArray(size_t length) override {
+    auto array = new StubObject(StubObject::Kind::Array);
+    array->elements.resize(length);
+    return make<Array>(array);
+  }
+
+  ArrayBuffer createArrayBuffer(
+      std::shared_ptr<MutableBuffer> buffer) override {
+    auto arrayBuffer = new StubObject(StubObject::Kind::ArrayBuffer);
+    arrayBuffer->buffer = std::move(buffer);
+    return make<ArrayBuffer>(arrayBuffer);
+  }
+
+  size_t size(const Array& array) override {
+    return get<StubObject>(array).elements.size();
+  }
+
+  size_t size(const ArrayBuffer& arrayBuffer) override {
+    return get<StubObject>(arrayBuffer).buffer->size();
+  }
+
+  uint8_t* data(const ArrayBuffer& arrayBuffer) override {
+    return get<StubObject>(arrayBuffer).buffer->data();
+  }
+
+  Value getValueAtIndex(const Array& array, size_t i) override {
+    auto& elements = get<StubObject>(array).elements;
+    if (i >= elements.size()) {
+      throw JSINativeException(
+          "Index " + std::to_string(i) + " is out of bounds");
+    }
+    return Value(*this, elements[i]);
+  }
+
+  void setValueAtIndexImpl(const Array& array, size_t i, const Value& value)
+      override {
+    auto& elements = get<StubObject>(array).elements;
+    if (i >= elements.size()) {
+      throw JSINativeException(
+          "Index " + std::to_string(i) + " is out of bounds");
+    }
+    elements[i] = Value(*this, value);
+  }
+
+  Function createFunctionFromHostFunction(
+      const PropNameID& name,
+      unsigned int paramCount,
+      HostFunctionType func) override {
+    auto function = new StubObject(StubObject::Kind::HostFunction);
+    function->hostFunction = std::move(func);
+    function->properties.emplace(
+        "name", Value(String::createFromUtf8(*this, string(name))));
+    function->properties.emplace(
+        "length", Value(static_cast<double>(paramCount)));
+    return make<Function>(function);
+  }
+
+  Value call(
+      const Function& function,
+      const Value& jsThis,
+      const Value* args,
+      size_t count) override {
+    auto& value = get<StubObject>(function);
+    if (value.kind != StubObject::Kind::HostFunction) {
+      throw JSINativeException("Object is not a function");
+    }
+    return value.hostFunction(*this, jsThis, args, count);
+  }
+
+  Value callAsConstructor(
+      const Function& function,
+      const Value* args,
+      size_t count) override {
+    auto jsThis = Value(*this, createObject());
+    auto result = call(function, jsThis, args, count);
+    return result.isObject() ? std::move(result) : std::move(jsThis);
+  }
+
+  bool strictEquals(const Symbol& a, const Symbol& b) const override {
+    return getPointerValue(a) == getPointerValue(b);
+  }
+
+  bool strictEquals(const BigInt& a, const BigInt& b) const override {
+    auto& first = get<StubBigInt>(a);
+    auto& second = get<StubBigInt>(b);
+    return first.bits == second.bits &&
+        (first.isSigned == second.isSigned ||
+         static_cast<int64_t>(first.bits) >= 0);
+  }
+
+  bool strictEquals(const String& a, const String& b) const override {
+    return get<StubString>(a).str == get<StubString>(b).str;
+  }
+
+  bool strictEquals(const Object& a, const Object& b) const override {
+    return getPointerValue(a) == getPointerValue(b);
+  }
+
+  bool instanceOf(const Object& /*o*/, const Function& /*f*/) override {
+    return false;
+  }
+
+  void setExternalMemoryPressure(const Object& /*obj*/, size_t /*amount*/)
+      override {}
+
+ private:
+  template <typename T>
+  static T& get(const Pointer& pointer) {
+    return *static_cast<T*>(
+        const_cast<PointerValue*>(getPointerValue(pointer)));
+  }
+
+  static const std::string& string(const Pointer& pointer) {
+    return get<StubString>(pointer).str;
+  }
+
+  static PointerValue* retain(const PointerValue* pv) {
+    return static_cast<StubPointerValue*>(const_cast<PointerValue*>(pv))
+        ->retain();
+  }
+
+  Value getOwnProperty(const StubObject& object, const std::string& name) {
+    auto it = object.properties.find(name);
+    if (it != object.properties.end()) {
+      return Value(*this, it->second);
+    }
+    if (object.kind == StubObject::Kind::Array && name == "length") {
+      return Value(static_cast<double>(object.elements.size()));
+    }
+    return Value::undefined();
+  }
+
+  void setOwnProperty(
+      StubObject& object,
+      const std::string& name,
+      const Value& value) {
+    auto it = object.properties.find(name);
+    if (it != object.properties.end()) {
+      it->second = Value(*this, value);
+    } else {
+      object.properties.emplace(name, Value(*this, value));
+    }
+  }
+
+  Object global_;
+  std::deque<Object> microtasks_;
+};
+
+} // namespace
+
+std::unique_ptr<Runtime> makeStubRuntime() {
+  return std::make_unique<StubRuntime>();
+}
+
+} // namespace jsi
+} // namespace facebook
@@ -0,0 +1,24 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <memory>
+
+#include <jsi/jsi.h>
+
+namespace facebook {
+namespace jsi {
+
+/// Creates a runtime implementing the JSI object model (objects, arrays,
+/// array buffers, host objects and functions, native state) with plain C++
+/// containers. It cannot evaluate JavaScript. It is a baseline that measures
+/// the cost of the JSI API itself; it is not thread-safe.
+std::unique_ptr<Runtime> makeStubRuntime();
+
+} // namespace jsi
+} // namespace facebook
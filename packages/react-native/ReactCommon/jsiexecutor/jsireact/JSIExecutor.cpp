@@ -9,7 +9,9 @@
 
 #include <cxxreact/ErrorUtils.h>
 #include <cxxreact/JSBigString.h>
+#include <cxxreact/JSBigStringRegistry.h>
 #include <cxxreact/ModuleRegistry.h>
+#include <cxxreact/RAMBundleModuleCache.h>
 #include <cxxreact/ReactMarker.h>
 #include <cxxreact/SystraceSection.h>
 #include <folly/Conv.h>
@@ -55,6 +57,44 @@ class JSIExecutor::NativeModuleProxy : public jsi::HostObject {
 
 namespace {
 
+// Call queues drained from JS have the shape
+// [moduleIds, methodIds, params, callId?]. `null` means no calls.
+bool isWellFormedQueue(const folly::dynamic& calls) {
+  return calls.isNull() ||
+      (calls.isArray() && calls.size() >= 3 && calls[0].isArray() &&
+       calls[1].isArray() && calls[2].isArray() &&
+       calls[0].size() == calls[1].size() &&
+       calls[0].size() == calls[2].size());
+}
+
+// Appends well-formed `calls` to `heldCalls`. Call ids are consecutive across
+// queues, so the merged queue keeps the call id of its first call.
+void appendNativeModuleCalls(
+    folly::dynamic& heldCalls,
+    folly::dynamic&& calls) {
+  if (calls.isNull()) {
+    return;
+  }
+  if (heldCalls.isNull()) {
+    heldCalls = std::move(calls);
+    return;
+  }
+  for (size_t field = 0; field < 3; field++) {
+    for (auto& value : calls[field]) {
+      heldCalls[field].push_back(std::move(value));
+    }
+  }
+}
+
+void countNativeModuleCalls(
+    JSIExecutor::NativeCallStats& stats,
+    const folly::dynamic& calls) {
+  if (isWellFormedQueue(calls) && !calls.isNull()) {
+    stats.drainedQueues++;
+    stats.calls += calls[0].size();
+  }
+}
+
 // basename_r isn't in all iOS SDKs, so use this simple version instead.
 std::string simpleBasename(const std::string& path) {
   size_t pos = path.rfind("/");
@@ -195,7 +235,7 @@ void JSIExecutor::registerBundle(
   if (bundleRegistry_) {
     bundleRegistry_->registerBundle(bundleId, bundlePath);
   } else {
-    auto script = JSBigFileString::fromPath(bundlePath);
+    auto script = JSBigStringRegistry::shared().fromPath(bundlePath);
     if (script->size() == 0) {
       throw std::invalid_argument(
           "Empty bundle registered with ID " + tag + " from " + bundlePath);
@@ -390,15 +430,122 @@ void JSIExecutor::callNativeModules(const Value& queue, bool isEndOfBatch) {
 #endif
   BridgeNativeModulePerfLogger::asyncMethodCallBatchPreprocessStart();
 
-  delegate_->callNativeModules(
-      *this, dynamicFromValue(*runtime_, queue), isEndOfBatch);
+  auto calls = dynamicFromValue(*runtime_, queue);
+  countNativeModuleCalls(nativeCallStats_, calls);
+
+  // Held calls were made before these ones, so they go first.
+  if (!heldNativeCalls_.isNull()) {
+    if (isWellFormedQueue(calls)) {
+      appendNativeModuleCalls(heldNativeCalls_, std::move(calls));
+      calls = std::move(heldNativeCalls_);
+      heldNativeCalls_ = nullptr;
+    } else {
+      dispatchHeldNativeModuleCalls();
+    }
+  }
+
+  dispatchNativeModuleCalls(std::move(calls), isEndOfBatch);
+}
+
+void JSIExecutor::holdNativeModuleCalls(const Value& queue) {
+  if (nativeCallBatching_.window.count() == 0 || !flushScheduler_) {
+    callNativeModules(queue, true);
+    return;
+  }
+
+  SystraceSection s("JSIExecutor::holdNativeModuleCalls");
+  CHECK(delegate_) << "Attempting to use native modules without a delegate";
+  BridgeNativeModulePerfLogger::asyncMethodCallBatchPreprocessStart();
+
+  auto calls = dynamicFromValue(*runtime_, queue);
+  if (calls.isNull() && heldNativeCalls_.isNull()) {
+    // Nothing to hold; keep signaling the end of the batch right away.
+    dispatchNativeModuleCalls(std::move(calls), true);
+    return;
+  }
+
+  if (!isWellFormedQueue(calls)) {
+    // Let the delegate report it.
+    dispatchHeldNativeModuleCalls();
+    dispatchNativeModuleCalls(std::move(calls), true);
+    return;
+  }
+
+  countNativeModuleCalls(nativeCallStats_, calls);
+  auto now = std::chrono::steady_clock::now();
+  if (heldNativeCalls_.isNull()) {
+    heldNativeCallsSince_ = now;
+  }
+  appendNativeModuleCalls(heldNativeCalls_, std::move(calls));
+
+  if (now - heldNativeCallsSince_ >= nativeCallBatching_.window ||
+      heldNativeCalls_[0].size() >= nativeCallBatching_.maxCalls) {
+    dispatchHeldNativeModuleCalls();
+    return;
+  }
+
+  if (!heldNativeCallsFlushScheduled_) {
+    heldNativeCallsFlushScheduled_ = true;
+    flushScheduler_([this, alive = std::weak_ptr<bool>(alive_)]() {
+      if (!alive.lock()) {
+        return;
+      }
+      heldNativeCallsFlushScheduled_ = false;
+      dispatchHeldNativeModuleCalls();
+    });
+  }
+}
+
+void JSIExecutor::dispatchHeldNativeModuleCalls() {
+  if (heldNativeCalls_.isNull()) {
+    return;
+  }
+  auto calls = std::move(heldNativeCalls_);
+  heldNativeCalls_ = nullptr;
+  dispatchNativeModuleCalls(std::move(calls), true);
+}
+
+void JSIExecutor::dispatchNativeModuleCalls(
+    folly::dynamic&& calls,
+    bool isEndOfBatch) {
+  if (!calls.isNull()) {
+    nativeCallStats_.dispatchedBatches++;
+  }
+  delegate_->callNativeModules(*this, std::move(calls), isEndOfBatch);
+}
+
+void JSIExecutor::setNativeCallBatching(
+    NativeCallBatching batching,
+    FlushScheduler flushScheduler) {
+  nativeCallBatching_ = batching;
+  flushScheduler_ = std::move(flushScheduler);
+  if (nativeCallBatching_.window.count() == 0 || !flushScheduler_) {
+    dispatchHeldNativeModuleCalls();
+  }
+}
+
+JSIExecutor::NativeCallStats JSIExecutor::getNativeCallStats() const {
+  return nativeCallStats_;
+}
+
+double JSIExecutor::NativeCallStats::batchesPerSecond() const {
+  auto seconds = std::chrono::duration<double>(
+                     std::chrono::steady_clock::now() - since)
+                     .count();
+  return seconds > 0 ? static_cast<double>(dispatchedBatches) / seconds : 0;
+}
+
+double JSIExecutor::NativeCallStats::callsPerBatch() const {
+  return dispatchedBatches > 0
+      ? static_cast<double>(calls) / static_cast<double>(dispatchedBatches)
+      : 0;
 }
 
 void JSIExecutor::flush() {
   SystraceSection s("JSIExecutor::flush");
   if (flushedQueue_) {
     Value ret = flushedQueue_->call(*runtime_);
-    callNativeModules(ret, true);
+    holdNativeModuleCalls(ret);
     return;
   }
 
@@ -415,7 +562,7 @@ void JSIExecutor::flush() {
     // get the pending queue of native calls.
     bindBridge();
     Value ret = flushedQueue_->call(*runtime_);
-    callNativeModules(ret, true);
+    holdNativeModuleCalls(ret);
   } else if (delegate_) {
     // If we have a delegate, we need to call it; we pass a null list to
     // callNativeModules, since we know there are no native calls, without
@@ -434,8 +581,27 @@ Value JSIExecutor::nativeRequire(const Value* args, size_t count) {
   uint32_t bundleId = count == 2 ? folly::to<uint32_t>(args[1].getNumber()) : 0;
   auto module = bundleRegistry_->getModule(bundleId, moduleId);
 
-  runtime_->evaluateJavaScript(
-      std::make_unique<StringBuffer>(module.code), module.name);
+  if (!module.sharedCode) {
+    runtime_->evaluateJavaScript(
+        std::make_unique<StringBuffer>(module.code), module.name);
+    return facebook::jsi::Value();
+  }
+
+  auto& cache = RAMBundleModuleCache::shared();
+  const auto runtimeKind = runtime_->description();
+  auto prepared = cache.getPreparedJavaScript(*module.sharedCode, runtimeKind);
+  if (!prepared && cache.cachesPreparedJavaScript()) {
+    prepared = runtime_->prepareJavaScript(
+        std::make_shared<BigStringBuffer>(module.sharedCode), module.name);
+    cache.setPreparedJavaScript(*module.sharedCode, runtimeKind, prepared);
+  }
+
+  if (prepared) {
+    runtime_->evaluatePreparedJavaScript(prepared);
+  } else {
+    runtime_->evaluateJavaScript(
+        std::make_shared<BigStringBuffer>(module.sharedCode), module.name);
+  }
   return facebook::jsi::Value();
 }
 
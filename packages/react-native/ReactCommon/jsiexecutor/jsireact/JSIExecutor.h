@@ -13,6 +13,7 @@
 #include <cxxreact/JSExecutor.h>
 #include <cxxreact/RAMBundleRegistry.h>
 #include <jsi/jsi.h>
+#include <chrono>
 #include <functional>
 #include <mutex>
 #include <optional>
@@ -53,7 +54,7 @@ using JSIScopedTimeoutInvoker = std::function<void(
 
 class BigStringBuffer : public jsi::Buffer {
  public:
-  BigStringBuffer(std::unique_ptr<const JSBigString> script)
+  BigStringBuffer(std::shared_ptr<const JSBigString> script)
       : script_(std::move(script)) {}
 
   size_t size() const override {
@@ -65,13 +66,44 @@ class BigStringBuffer : public jsi::Buffer {
   }
 
  private:
-  std::unique_ptr<const JSBigString> script_;
+  std::shared_ptr<const JSBigString> script_;
 };
 
 class JSIExecutor : public JSExecutor {
  public:
   using RuntimeInstaller = std::function<void(jsi::Runtime& runtime)>;
 
+  // Schedules work to run on the JS thread after the work already queued
+  // there.
+  using FlushScheduler = std::function<void(std::function<void()>&&)>;
+
+  // Native module calls drained from JS by `flush()` (i.e. at the end of
+  // every piece of work run on the JS thread) can be held back and dispatched
+  // together with later ones, instead of costing a delegate dispatch each.
+  // Held calls are dispatched once they are `window` old or there are
+  // `maxCalls` of them, once the JS thread gets to the work scheduled when
+  // they were held, and before any other calls: calls returned from
+  // `callFunction`/`invokeCallback` and calls from
+  // `nativeFlushQueueImmediate` are never held.
+  struct NativeCallBatching {
+    // Zero disables batching.
+    std::chrono::milliseconds window{0};
+    size_t maxCalls{64};
+  };
+
+  struct NativeCallStats {
+    std::chrono::steady_clock::time_point since{
+        std::chrono::steady_clock::now()};
+    // Non-empty call queues drained from JS.
+    size_t drainedQueues{0};
+    // Batches of calls handed to the delegate.
+    size_t dispatchedBatches{0};
+    size_t calls{0};
+
+    double batchesPerSecond() const;
+    double callsPerBatch() const;
+  };
+
   JSIExecutor(
       std::shared_ptr<jsi::Runtime> runtime,
       std::shared_ptr<ExecutorDelegate> delegate,
@@ -109,11 +141,20 @@ class JSIExecutor : public JSExecutor {
 
   void flush() override;
 
+  // Must be called on the JS thread.
+  void setNativeCallBatching(
+      NativeCallBatching batching,
+      FlushScheduler flushScheduler);
+  NativeCallStats getNativeCallStats() const;
+
  private:
   class NativeModuleProxy;
 
   void bindBridge();
   void callNativeModules(const jsi::Value& queue, bool isEndOfBatch);
+  void holdNativeModuleCalls(const jsi::Value& queue);
+  void dispatchNativeModuleCalls(folly::dynamic&& calls, bool isEndOfBatch);
+  void dispatchHeldNativeModuleCalls();
   jsi::Value nativeCallSyncHook(const jsi::Value* args, size_t count);
   jsi::Value nativeRequire(const jsi::Value* args, size_t count);
   jsi::Value globalEvalWithSourceUrl(const jsi::Value* args, size_t count);
@@ -130,6 +171,15 @@ class JSIExecutor : public JSExecutor {
   std::optional<jsi::Function> callFunctionReturnFlushedQueue_;
   std::optional<jsi::Function> invokeCallbackAndReturnFlushedQueue_;
   std::optional<jsi::Function> flushedQueue_;
+
+  NativeCallBatching nativeCallBatching_;
+  FlushScheduler flushScheduler_;
+  folly::dynamic heldNativeCalls_;
+  std::chrono::steady_clock::time_point heldNativeCallsSince_;
+  bool heldNativeCallsFlushScheduled_{false};
+  NativeCallStats nativeCallStats_;
+  // Lets scheduled flushes tell whether the executor is still alive.
+  std::shared_ptr<bool> alive_{std::make_shared<bool>(true)};
 };
 
 using Logger =
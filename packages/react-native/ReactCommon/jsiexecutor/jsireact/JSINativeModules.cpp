@@ -15,6 +15,7 @@
 #include <jsi/JSIDynamic.h>
 
 #include <string>
+#include <vector>
 
 using namespace facebook::jsi;
 
@@ -64,6 +65,67 @@ void JSINativeModules::reset() {
   m_objects.clear();
 }
 
+// Builds the same config as ModuleRegistry::getConfig, without going through
+// folly::dynamic for the method table:
+// string name, object constants, array methodNames (methodId is index),
+// [array promiseMethodIds], [array syncMethodIds]
+Array JSINativeModules::createModuleConfig(
+    Runtime& rt,
+    const ModuleDescription& description) {
+  const auto& methods = *description.methods;
+
+  auto methodNames = Array(rt, methods.size());
+  auto promiseMethodIds = std::vector<size_t>{};
+  auto syncMethodIds = std::vector<size_t>{};
+  for (size_t methodId = 0; methodId < methods.size(); methodId++) {
+    auto methodName = methods.nameAt(methodId);
+    methodNames.setValueAtIndex(
+        rt,
+        methodId,
+        String::createFromUtf8(
+            rt,
+            reinterpret_cast<const uint8_t*>(methodName.data()),
+            methodName.size()));
+    if (methods.isPromise(methodId)) {
+      promiseMethodIds.push_back(methodId);
+    } else if (methods.isSync(methodId)) {
+      syncMethodIds.push_back(methodId);
+    }
+  }
+
+  auto toArray = [&](const std::vector<size_t>& methodIds) {
+    auto array = Array(rt, methodIds.size());
+    for (size_t i = 0; i < methodIds.size(); i++) {
+      array.setValueAtIndex(rt, i, static_cast<double>(methodIds[i]));
+    }
+    return array;
+  };
+
+  // Trailing arrays are left out when they would be empty.
+  size_t length = 2;
+  if (!syncMethodIds.empty()) {
+    length = 5;
+  } else if (!promiseMethodIds.empty()) {
+    length = 4;
+  } else if (methods.size() > 0) {
+    length = 3;
+  }
+
+  auto config = Array(rt, length);
+  config.setValueAtIndex(rt, 0, String::createFromUtf8(rt, description.name));
+  config.setValueAtIndex(rt, 1, valueFromDynamic(rt, description.constants));
+  if (length > 2) {
+    config.setValueAtIndex(rt, 2, std::move(methodNames));
+  }
+  if (length > 3) {
+    config.setValueAtIndex(rt, 3, toArray(promiseMethodIds));
+  }
+  if (length > 4) {
+    config.setValueAtIndex(rt, 4, toArray(syncMethodIds));
+  }
+  return config;
+}
+
 std::optional<Object> JSINativeModules::createModule(
     Runtime& rt,
     const std::string& name) {
@@ -78,15 +140,15 @@ std::optional<Object> JSINativeModules::createModule(
         rt.global().getPropertyAsFunction(rt, "__fbGenNativeModule");
   }
 
-  auto result = m_moduleRegistry->getConfig(name);
-  if (!result.has_value()) {
+  auto description = m_moduleRegistry->getModuleDescription(name);
+  if (!description.has_value()) {
     return std::nullopt;
   }
 
+  auto config = createModuleConfig(rt, *description);
+
   Value moduleInfo = m_genNativeModuleJS->call(
-      rt,
-      valueFromDynamic(rt, result->config),
-      static_cast<double>(result->index));
+      rt, std::move(config), static_cast<double>(description->index));
   CHECK(!moduleInfo.isNull()) << "Module returned from genNativeModule is null";
   CHECK(moduleInfo.isObject())
       << "Module returned from genNativeModule isn't an Object";
@@ -33,6 +33,10 @@ class JSINativeModules {
   std::optional<jsi::Object> createModule(
       jsi::Runtime& rt,
       const std::string& name);
+
+  static jsi::Array createModuleConfig(
+      jsi::Runtime& rt,
+      const ModuleDescription& description);
 };
 
 } // namespace facebook::react
@@ -0,0 +1,238 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <hermes/hermes.h>
+#include <jsi/jsi.h>
+#include <jsireact/JSIExecutor.h>
+
+using namespace facebook;
+using namespace facebook::react;
+
+namespace {
+
+/*
+ * A minimal `__fbBatchedBridge`: `enqueue(n)` queues `n` calls to method ids
+ * counting up from zero, and every `...FlushedQueue` method returns the queue.
+ */
+constexpr auto kBatchedBridge = R"(
+var nextMethodId = 0;
+var nextCallId = 0;
+var queue = null;
+function enqueue(count) {
+  for (var i = 0; i < count; i++) {
+    if (queue === null) {
+      queue = [[], [], [], nextCallId];
+    }
+    queue[0].push(0);
+    queue[1].push(nextMethodId++);
+    queue[2].push([]);
+    nextCallId++;
+  }
+}
+function flushedQueue() {
+  var result = queue;
+  queue = null;
+  return result;
+}
+var __fbBatchedBridge = {
+  flushedQueue: flushedQueue,
+  callFunctionReturnFlushedQueue: function(module, method, args) {
+    enqueue(1);
+    return flushedQueue();
+  },
+  invokeCallbackAndReturnFlushedQueue: function(callbackId, args) {
+    enqueue(1);
+    return flushedQueue();
+  },
+};
+)";
+
+struct Batch {
+  folly::dynamic calls;
+  bool isEndOfBatch;
+};
+
+class RecordingExecutorDelegate : public ExecutorDelegate {
+ public:
+  std::shared_ptr<ModuleRegistry> getModuleRegistry() override {
+    return nullptr;
+  }
+
+  void callNativeModules(
+      JSExecutor& /*executor*/,
+      folly::dynamic&& calls,
+      bool isEndOfBatch) override {
+    batches.push_back({std::move(calls), isEndOfBatch});
+  }
+
+  MethodCallResult callSerializableNativeHook(
+      JSExecutor& /*executor*/,
+      unsigned int /*moduleId*/,
+      unsigned int /*methodId*/,
+      folly::dynamic&& /*args*/) override {
+    return std::nullopt;
+  }
+
+  /*
+   * Method ids of all dispatched calls, in dispatch order.
+   */
+  std::vector<int> methodIds() const {
+    auto result = std::vector<int>{};
+    for (const auto& batch : batches) {
+      if (!batch.calls.isNull()) {
+        for (const auto& methodId : batch.calls[1]) {
+          result.push_back(static_cast<int>(methodId.asInt()));
+        }
+      }
+    }
+    return result;
+  }
+
+  std::vector<Batch> batches;
+};
+
+} // namespace
+
+class JSIExecutorTest : public ::testing::Test {
+ protected:
+  JSIExecutorTest()
+      : runtime_(hermes::makeHermesRuntime()),
+        delegate_(std::make_shared<RecordingExecutorDelegate>()),
+        executor_(
+            runtime_,
+            delegate_,
+            JSIExecutor::defaultTimeoutInvoker,
+            nullptr) {
+    runtime_->evaluateJavaScript(
+        std::make_shared<jsi::StringBuffer>(kBatchedBridge), "bridge.js");
+  }
+
+  void enqueue(int count) {
+    runtime_->global()
+        .getPropertyAsFunction(*runtime_, "enqueue")
+        .call(*runtime_, count);
+  }
+
+  void enableBatching(size_t maxCalls = 64) {
+    executor_.setNativeCallBatching(
+        {/* .window = */ std::chrono::milliseconds{1000},
+         /* .maxCalls = */ maxCalls},
+        [this](std::function<void()>&& work) {
+          scheduledWork_.push_back(std::move(work));
+        });
+  }
+
+  void runScheduledWork() {
+    auto scheduledWork = std::move(scheduledWork_);
+    scheduledWork_.clear();
+    for (auto& work : scheduledWork) {
+      work();
+    }
+  }
+
+  std::shared_ptr<jsi::Runtime> runtime_;
+  std::shared_ptr<RecordingExecutorDelegate> delegate_;
+  JSIExecutor executor_;
+  std::vector<std::function<void()>> scheduledWork_;
+};
+
+TEST_F(JSIExecutorTest, everyFlushIsDispatchedByDefault) {
+  enqueue(1);
+  executor_.flush();
+  enqueue(2);
+  executor_.flush();
+
+  ASSERT_EQ(delegate_->batches.size(), 2);
+  EXPECT_EQ(delegate_->methodIds(), (std::vector<int>{0, 1, 2}));
+  EXPECT_TRUE(delegate_->batches[1].isEndOfBatch);
+}
+
+TEST_F(JSIExecutorTest, flushesAreMergedUntilScheduledFlush) {
+  enableBatching();
+
+  for (int i = 0; i < 3; i++) {
+    enqueue(1);
+    executor_.flush();
+  }
+
+  EXPECT_TRUE(delegate_->batches.empty());
+  EXPECT_EQ(scheduledWork_.size(), 1);
+
+  runScheduledWork();
+
+  ASSERT_EQ(delegate_->batches.size(), 1);
+  EXPECT_EQ(delegate_->methodIds(), (std::vector<int>{0, 1, 2}));
+  // The merged queue keeps the call id of its first call.
+  EXPECT_EQ(delegate_->batches[0].calls[3].asInt(), 0);
+
+  auto stats = executor_.getNativeCallStats();
+  EXPECT_EQ(stats.drainedQueues, 3);
+  EXPECT_EQ(stats.dispatchedBatches, 1);
+  EXPECT_EQ(stats.calls, 3);
+  EXPECT_EQ(stats.callsPerBatch(), 3);
+}
+
+TEST_F(JSIExecutorTest, heldCallsAreDispatchedAtMaxCalls) {
+  enableBatching(/* maxCalls */ 4);
+
+  enqueue(2);
+  executor_.flush();
+  EXPECT_TRUE(delegate_->batches.empty());
+
+  enqueue(2);
+  executor_.flush();
+  ASSERT_EQ(delegate_->batches.size(), 1);
+  EXPECT_EQ(delegate_->methodIds(), (std::vector<int>{0, 1, 2, 3}));
+
+  // The scheduled flush has nothing left to dispatch.
+  runScheduledWork();
+  EXPECT_EQ(delegate_->batches.size(), 1);
+}
+
+TEST_F(JSIExecutorTest, callsFromCallFunctionAreNeverHeld) {
+  enableBatching();
+
+  enqueue(2);
+  executor_.flush();
+  executor_.callFunction("Module", "method", folly::dynamic::array());
+
+  // Held calls are dispatched first, together with the new one.
+  ASSERT_EQ(delegate_->batches.size(), 1);
+  EXPECT_EQ(delegate_->methodIds(), (std::vector<int>{0, 1, 2}));
+  EXPECT_TRUE(delegate_->batches[0].isEndOfBatch);
+}
+
+TEST_F(JSIExecutorTest, disablingBatchingDispatchesHeldCalls) {
+  enableBatching();
+
+  enqueue(1);
+  executor_.flush();
+  EXPECT_TRUE(delegate_->batches.empty());
+
+  executor_.setNativeCallBatching({}, nullptr);
+  EXPECT_EQ(delegate_->methodIds(), (std::vector<int>{0}));
+
+  // A scheduled flush which runs later has no effect.
+  runScheduledWork();
+  EXPECT_EQ(delegate_->batches.size(), 1);
+}
+
+TEST_F(JSIExecutorTest, emptyFlushesStillEndTheBatch) {
+  enableBatching();
+
+  executor_.flush();
+
+  ASSERT_EQ(delegate_->batches.size(), 1);
+  EXPECT_TRUE(delegate_->batches[0].calls.isNull());
+  EXPECT_TRUE(delegate_->batches[0].isEndOfBatch);
+  EXPECT_TRUE(scheduledWork_.empty());
+}
@@ -6,6 +6,7 @@
  */
 
 #include "react_native_log.h"
+#include "react_native_log_async.h"
 #include <glog/logging.h>
 
 static reactnativelogfunctype _reactnativelogfunc = NULL;
@@ -13,6 +14,9 @@ static reactnativelogfunctype _reactnativelogfunc = NULL;
 void set_react_native_logfunc(reactnativelogfunctype newlogfunc) {
   _reactnativelogfunc = newlogfunc;
 }
+void set_react_native_log_async_enabled(int enabled) {
+  facebook::react::setAsyncLogEnabled(enabled != 0);
+}
 void react_native_log_info(const char* message) {
   _react_native_log(ReactNativeLogLevelInfo, message);
 }
@@ -26,7 +30,9 @@ void react_native_log_fatal(const char* message) {
   _react_native_log(ReactNativeLogLevelFatal, message);
 }
 
-void _react_native_log(ReactNativeLogLevel level, const char* message) {
+static void _react_native_log_sync(
+    ReactNativeLogLevel level,
+    const char* message) {
   if (_reactnativelogfunc == NULL) {
     _react_native_log_default(level, message);
   } else {
@@ -34,6 +40,17 @@ void _react_native_log(ReactNativeLogLevel level, const char* message) {
   }
 }
 
+void _react_native_log(ReactNativeLogLevel level, const char* message) {
+  if (level == ReactNativeLogLevelFatal) {
+    // Keep the messages that led to this one.
+    facebook::react::flushAsyncLog();
+  } else if (facebook::react::enqueueAsyncLog(
+                 level, message, _react_native_log_sync)) {
+    return;
+  }
+  _react_native_log_sync(level, message);
+}
+
 void _react_native_log_default(ReactNativeLogLevel level, const char* message) {
   switch (level) {
     case ReactNativeLogLevelInfo:
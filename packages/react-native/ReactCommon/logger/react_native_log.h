@@ -21,6 +21,13 @@ extern "C" {
 #endif // __cplusplus
 void set_react_native_logfunc(reactnativelogfunctype newlogfunc);
 
+// When enabled, info, warning and error messages are handed to a background
+// thread instead of being logged on the calling thread. Repeated messages are
+// rate limited and collapsed, and messages are dropped (and counted) rather
+// than blocking the caller when the thread falls behind. Fatal messages are
+// always logged synchronously. Disabled by default.
+void set_react_native_log_async_enabled(int enabled);
+
 void react_native_log_info(const char* text);
 void react_native_log_warn(const char* text);
 void react_native_log_error(const char* text);
@@ -0,0 +1,299 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "react_native_log_async.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace facebook::react {
+
+namespace {
+
+// Longer messages are truncated.
+constexpr size_t kMaxMessageLength = 512;
+// Messages queued per thread before new ones are dropped.
+constexpr size_t kBufferCapacity = 64;
+// Occurrences of the same message logged per thread and per second.
+constexpr size_t kMaxRepeatsPerSecond = 10;
+// Slots of the per-thread rate limiting table; messages whose hashes share a
+// slot evict each other.
+constexpr size_t kRateLimitSlots = 128;
+
+struct LogEntry {
+  ReactNativeLogLevel level;
+  char text[kMaxMessageLength];
+};
+
+struct RateLimit {
+  size_t key;
+  std::chrono::steady_clock::time_point windowStart;
+  // Zero for an unused slot.
+  size_t count;
+};
+
+// Single-producer single-consumer ring buffer. Only the owning thread writes
+// `tail` and `rateLimits`; only the draining thread writes `head`.
+struct ThreadBuffer {
+  std::array<LogEntry, kBufferCapacity> entries;
+  std::atomic<size_t> head{0};
+  std::atomic<size_t> tail{0};
+  // Messages dropped because the buffer was full or rate limited.
+  std::atomic<size_t> dropped{0};
+  // The owning thread has exited; the buffer goes away once it is drained.
+  std::atomic<bool> orphaned{false};
+  std::array<RateLimit, kRateLimitSlots> rateLimits{};
+};
+
+// Set while the current thread drains the buffers, so that messages logged by
+// `dispatch` itself are not queued (or flushed) again.
+thread_local bool isDraining = false;
+
+class AsyncLogSink {
+ public:
+  static AsyncLogSink& shared() {
+    // Intentionally leaked: messages may be logged while static destructors
+    // run.
+    static auto* sink = new AsyncLogSink();
+    return *sink;
+  }
+
+  void setEnabled(bool enabled) {
+    if (enabled) {
+      std::call_once(threadStarted_, [this] {
+        std::thread([this] { run(); }).detach();
+      });
+      enabled_ = true;
+    } else {
+      enabled_ = false;
+      flush();
+    }
+  }
+
+  bool enqueue(
+      ReactNativeLogLevel level,
+      const char* message,
+      reactnativelogfunctype dispatch) {
+    if (!enabled_.load(std::memory_order_relaxed) || isDraining) {
+      return false;
+    }
+    dispatch_.store(dispatch, std::memory_order_relaxed);
+
+    auto& buffer = threadBuffer();
+    auto text = std::string_view(message);
+    if (isRateLimited(buffer, level, text)) {
+      buffer.dropped.fetch_add(1, std::memory_order_relaxed);
+      return true;
+    }
+
+    auto tail = buffer.tail.load(std::memory_order_relaxed);
+    if (tail - buffer.head.load(std::memory_order_acquire) >= kBufferCapacity) {
+      buffer.dropped.fetch_add(1, std::memory_order_relaxed);
+      return true;
+    }
+
+    auto& entry = buffer.entries[tail % kBufferCapacity];
+    entry.level = level;
+    auto length = std::min(text.size(), kMaxMessageLength - 1);
+    std::memcpy(entry.text, text.data(), length);
+    entry.text[length] = '\0';
+    buffer.tail.store(tail + 1, std::memory_order_release);
+
+    if (!pending_.exchange(true, std::memory_order_acq_rel)) {
+      // Taking the lock orders this with the check of the waiting thread, so
+      // the notification cannot fall between its check and its wait.
+      {
+        std::scoped_lock lock(mutex_);
+      }
+      condition_.notify_one();
+    }
+    return true;
+  }
+
+  // Does nothing when called by `dispatch` during a drain; the messages
+  // queued so far are being logged anyway.
+  void flush() {
+    if (!isDraining) {
+      drain();
+    }
+  }
+
+ private:
+  struct ThreadBufferHolder {
+    std::shared_ptr<ThreadBuffer> buffer;
+
+    ~ThreadBufferHolder() {
+      if (buffer) {
+        buffer->orphaned = true;
+      }
+    }
+  };
+
+  ThreadBuffer& threadBuffer() {
+    thread_local ThreadBufferHolder holder;
+    if (!holder.buffer) {
+      holder.buffer = std::make_shared<ThreadBuffer>();
+      std::scoped_lock lock(mutex_);
+      buffers_.push_back(holder.buffer);
+    }
+    return *holder.buffer;
+  }
+
+  static bool isRateLimited(
+      ThreadBuffer& buffer,
+      ReactNativeLogLevel level,
+      std::string_view text) {
+    auto now = std::chrono::steady_clock::now();
+    auto key = std::hash<std::string_view>{}(text) ^ static_cast<size_t>(level);
+    auto& rateLimit = buffer.rateLimits[key % kRateLimitSlots];
+    if (rateLimit.count == 0 || rateLimit.key != key ||
+        now - rateLimit.windowStart >= std::chrono::seconds(1)) {
+      rateLimit = RateLimit{key, now, 1};
+      return false;
+    }
+    return ++rateLimit.count > kMaxRepeatsPerSecond;
+  }
+
+  void run() {
+    while (true) {
+      {
+        std::unique_lock lock(mutex_);
+        condition_.wait(lock, [this] {
+          return pending_.load(std::memory_order_acquire);
+        });
+      }
+      drain();
+    }
+  }
+
+  void drain() {
+    std::scoped_lock drainLock(drainMutex_);
+    isDraining = true;
+    struct DrainingScope {
+      ~DrainingScope() {
+        isDraining = false;
+      }
+    } drainingScope;
+    drainBuffers();
+  }
+
+  void drainBuffers() {
+    // Acquire pairs with the producers' exchange, so that the messages they
+    // published before requesting this drain are visible below.
+    pending_.exchange(false, std::memory_order_acq_rel);
+
+    auto dispatch = dispatch_.load(std::memory_order_relaxed);
+    if (dispatch == nullptr) {
+      return;
+    }
+
+    std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+    {
+      std::scoped_lock lock(mutex_);
+      buffers = buffers_;
+    }
+
+    size_t dropped = 0;
+    for (const auto& buffer : buffers) {
+      // Read before draining, so that an orphaned buffer is known to be
+      // complete.
+      bool orphaned = buffer->orphaned.load(std::memory_order_acquire);
+      auto head = buffer->head.load(std::memory_order_relaxed);
+      auto tail = buffer->tail.load(std::memory_order_acquire);
+      for (; head != tail; head++) {
+        const auto& entry = buffer->entries[head % kBufferCapacity];
+        emit(entry.level, entry.text, dispatch);
+        buffer->head.store(head + 1, std::memory_order_release);
+      }
+      dropped += buffer->dropped.exchange(0, std::memory_order_relaxed);
+
+      if (orphaned) {
+        std::scoped_lock lock(mutex_);
+        buffers_.erase(
+            std::remove(buffers_.begin(), buffers_.end(), buffer),
+            buffers_.end());
+      }
+    }
+    emitRepeats(dispatch);
+
+    if (dropped > 0) {
+      auto message = "react_native_log: dropped " + std::to_string(dropped) +
+          " messages logged too often or too fast";
+      dispatch(ReactNativeLogLevelWarning, message.c_str());
+    }
+  }
+
+  // Collapses consecutive identical messages into a single one followed by a
+  // count.
+  void emit(
+      ReactNativeLogLevel level,
+      const char* text,
+      reactnativelogfunctype dispatch) {
+    if (level == lastLevel_ && !lastText_.empty() && lastText_ == text) {
+      repeats_++;
+      return;
+    }
+    emitRepeats(dispatch);
+    lastLevel_ = level;
+    lastText_ = text;
+    dispatch(level, text);
+  }
+
+  void emitRepeats(reactnativelogfunctype dispatch) {
+    if (repeats_ > 0) {
+      auto message = "react_native_log: previous message repeated " +
+          std::to_string(repeats_) + " more times";
+      dispatch(lastLevel_, message.c_str());
+      repeats_ = 0;
+    }
+    lastText_.clear();
+  }
+
+  std::atomic<bool> enabled_{false};
+  std::atomic<bool> pending_{false};
+  std::atomic<reactnativelogfunctype> dispatch_{nullptr};
+  std::once_flag threadStarted_;
+
+  std::mutex mutex_;
+  std::condition_variable condition_;
+  std::vector<std::shared_ptr<ThreadBuffer>> buffers_;
+
+  // Guards draining and the state below.
+  std::mutex drainMutex_;
+  ReactNativeLogLevel lastLevel_{ReactNativeLogLevelInfo};
+  std::string lastText_;
+  size_t repeats_{0};
+};
+
+} // namespace
+
+void setAsyncLogEnabled(bool enabled) {
+  AsyncLogSink::shared().setEnabled(enabled);
+}
+
+bool enqueueAsyncLog(
+    ReactNativeLogLevel level,
+    const char* message,
+    reactnativelogfunctype dispatch) {
+  return AsyncLogSink::shared().enqueue(level, message, dispatch);
+}
+
+void flushAsyncLog() {
+  AsyncLogSink::shared().flush();
+}
+
+} // namespace facebook::react
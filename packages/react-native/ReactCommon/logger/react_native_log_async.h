@@ -0,0 +1,36 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include "react_native_log.h"
+
+namespace facebook::react {
+
+// Background sink behind `set_react_native_log_async_enabled`.
+//
+// Every thread writes into its own fixed-size ring buffer without taking any
+// lock (apart from registering the buffer on its first message), and a single
+// background thread drains the buffers and calls `dispatch`. Messages are
+// truncated to a fixed length, so memory use is bounded by the number of
+// logging threads.
+
+void setAsyncLogEnabled(bool enabled);
+
+// Returns false if async logging is disabled or if called by `dispatch` while
+// queued messages are being logged; the caller must then log the message
+// itself. Otherwise the message was queued, rate limited or dropped.
+bool enqueueAsyncLog(
+    ReactNativeLogLevel level,
+    const char* message,
+    reactnativelogfunctype dispatch);
+
+// Logs all queued messages on the calling thread. Does nothing when called by
+// `dispatch`.
+void flushAsyncLog();
+
+} // namespace facebook::react
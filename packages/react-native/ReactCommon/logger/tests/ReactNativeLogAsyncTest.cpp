@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <logger/react_native_log_async.h>
+
+using namespace facebook::react;
+
+namespace {
+
+std::mutex logMutex;
+std::vector<std::pair<ReactNativeLogLevel, std::string>> logged;
+
+void recordLog(ReactNativeLogLevel level, const char* message) {
+  std::scoped_lock lock(logMutex);
+  logged.emplace_back(level, message);
+}
+
+/*
+ * Logs, from within the log function, like a platform logger reporting its
+ * own failure would.
+ */
+void reentrantLog(ReactNativeLogLevel level, const char* message) {
+  recordLog(level, message);
+  if (std::string(message).find(" reentrant ") != std::string::npos) {
+    flushAsyncLog();
+    if (!enqueueAsyncLog(ReactNativeLogLevelError, "nested", recordLog)) {
+      recordLog(ReactNativeLogLevelError, "nested");
+    }
+  }
+}
+
+/*
+ * Returns how many times `message` was logged, counting collapsed repeats.
+ */
+size_t countLogged(const std::string& message) {
+  const auto repeatedPrefix =
+      std::string("react_native_log: previous message repeated ");
+  size_t count = 0;
+  bool isPrevious = false;
+  for (const auto& [level, text] : logged) {
+    if (text == message) {
+      count++;
+      isPrevious = true;
+    } else if (isPrevious && text.rfind(repeatedPrefix, 0) == 0) {
+      count += std::stoul(text.substr(repeatedPrefix.size()));
+    } else {
+      isPrevious = false;
+    }
+  }
+  return count;
+}
+
+size_t countDropped() {
+  const auto droppedPrefix = std::string("react_native_log: dropped ");
+  size_t count = 0;
+  for (const auto& [level, text] : logged) {
+    if (text.rfind(droppedPrefix, 0) == 0) {
+      count += std::stoul(text.substr(droppedPrefix.size()));
+    }
+  }
+  return count;
+}
+
+} // namespace
+
+class ReactNativeLogAsyncTest : public ::testing::Test {
+ protected:
+  ReactNativeLogAsyncTest() {
+    run_++;
+    setAsyncLogEnabled(true);
+    std::scoped_lock lock(logMutex);
+    logged.clear();
+  }
+
+  ~ReactNativeLogAsyncTest() override {
+    setAsyncLogEnabled(false);
+  }
+
+  // Messages are rate limited per thread and by text, so every run of a test
+  // logs its own messages.
+  static std::string message(const std::string& name, int index = 0) {
+    return ::testing::UnitTest::GetInstance()->current_test_info()->name() +
+        std::string(" ") + std::to_string(run_) + " " + name + " " +
+        std::to_string(index);
+  }
+
+  static inline int run_{0};
+};
+
+TEST_F(ReactNativeLogAsyncTest, messagesAreLoggedInOrder) {
+  for (int i = 0; i < 10; i++) {
+    EXPECT_TRUE(enqueueAsyncLog(
+        ReactNativeLogLevelInfo, message("info", i).c_str(), recordLog));
+  }
+  flushAsyncLog();
+
+  std::scoped_lock lock(logMutex);
+  ASSERT_EQ(logged.size(), 10);
+  for (int i = 0; i < 10; i++) {
+    EXPECT_EQ(logged[i].first, ReactNativeLogLevelInfo);
+    EXPECT_EQ(logged[i].second, message("info", i));
+  }
+}
+
+TEST_F(ReactNativeLogAsyncTest, messagesOfEachThreadStayInOrder) {
+  auto threads = std::vector<std::thread>{};
+  for (int thread = 0; thread < 4; thread++) {
+    threads.emplace_back([thread] {
+      for (int i = 0; i < 50; i++) {
+        auto text = message("thread " + std::to_string(thread), i);
+        enqueueAsyncLog(ReactNativeLogLevelInfo, text.c_str(), recordLog);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  flushAsyncLog();
+
+  std::scoped_lock lock(logMutex);
+  for (int thread = 0; thread < 4; thread++) {
+    auto prefix = message("thread " + std::to_string(thread), 0);
+    prefix.pop_back();
+    int next = 0;
+    for (const auto& [level, text] : logged) {
+      if (text.rfind(prefix, 0) == 0) {
+        EXPECT_EQ(text, prefix + std::to_string(next));
+        next++;
+      }
+    }
+    // Messages only get dropped if a buffer is full.
+    EXPECT_GE(next + countDropped(), 50);
+  }
+}
+
+TEST_F(ReactNativeLogAsyncTest, repeatedMessagesAreRateLimited) {
+  auto text = message("spam");
+  for (int i = 0; i < 25; i++) {
+    EXPECT_TRUE(
+        enqueueAsyncLog(ReactNativeLogLevelWarning, text.c_str(), recordLog));
+  }
+  flushAsyncLog();
+
+  std::scoped_lock lock(logMutex);
+  EXPECT_EQ(countLogged(text), 10);
+  EXPECT_EQ(countDropped(), 15);
+}
+
+TEST_F(ReactNativeLogAsyncTest, rateLimitsAreKeptPerLevel) {
+  auto text = message("spam");
+  for (int i = 0; i < 10; i++) {
+    enqueueAsyncLog(ReactNativeLogLevelWarning, text.c_str(), recordLog);
+  }
+  enqueueAsyncLog(ReactNativeLogLevelError, text.c_str(), recordLog);
+  flushAsyncLog();
+
+  std::scoped_lock lock(logMutex);
+  EXPECT_EQ(countDropped(), 0);
+  ASSERT_FALSE(logged.empty());
+  EXPECT_EQ(logged.back().first, ReactNativeLogLevelError);
+  EXPECT_EQ(logged.back().second, text);
+}
+
+TEST_F(ReactNativeLogAsyncTest, disablingFlushesQueuedMessages) {
+  EXPECT_TRUE(enqueueAsyncLog(
+      ReactNativeLogLevelInfo, message("queued").c_str(), recordLog));
+
+  setAsyncLogEnabled(false);
+
+  {
+    std::scoped_lock lock(logMutex);
+    ASSERT_EQ(logged.size(), 1);
+    EXPECT_EQ(logged[0].second, message("queued"));
+  }
+  EXPECT_FALSE(enqueueAsyncLog(
+      ReactNativeLogLevelInfo, message("rejected").c_str(), recordLog));
+}
+
+TEST_F(ReactNativeLogAsyncTest, logFunctionCanLogWhileDraining) {
+  EXPECT_TRUE(enqueueAsyncLog(
+      ReactNativeLogLevelError, message("reentrant").c_str(), reentrantLog));
+  flushAsyncLog();
+
+  std::scoped_lock lock(logMutex);
+  ASSERT_EQ(logged.size(), 2);
+  EXPECT_EQ(logged[0].second, message("reentrant"));
+  EXPECT_EQ(logged[1].second, "nested");
+}
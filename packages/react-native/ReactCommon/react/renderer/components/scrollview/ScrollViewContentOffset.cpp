@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ScrollViewContentOffset.h"
+
+namespace facebook::react {
+
+void ScrollViewContentOffset::set(Point contentOffset) noexcept {
+  // Writers normally all live on the main thread, but nothing prevents two of
+  // them from racing, so the odd sequence number is acquired with a CAS.
+  auto sequence = sequence_.load(std::memory_order_relaxed);
+  do {
+    sequence &= ~uint64_t{1};
+  } while (!sequence_.compare_exchange_weak(
+      sequence,
+      sequence + 1,
+      std::memory_order_acquire,
+      std::memory_order_relaxed));
+  std::atomic_thread_fence(std::memory_order_release);
+
+  x_.store(contentOffset.x, std::memory_order_relaxed);
+  y_.store(contentOffset.y, std::memory_order_relaxed);
+
+  sequence_.store(sequence + 2, std::memory_order_release);
+}
+
+std::optional<Point> ScrollViewContentOffset::get() const noexcept {
+  while (true) {
+    auto sequence = sequence_.load(std::memory_order_acquire);
+    if (sequence == 0) {
+      return std::nullopt;
+    }
+    if ((sequence & 1) != 0) {
+      continue;
+    }
+
+    auto contentOffset = Point{
+        x_.load(std::memory_order_relaxed), y_.load(std::memory_order_relaxed)};
+
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (sequence_.load(std::memory_order_relaxed) == sequence) {
+      return contentOffset;
+    }
+  }
+}
+
+} // namespace facebook::react
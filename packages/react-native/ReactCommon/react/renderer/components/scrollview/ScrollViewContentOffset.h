@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <optional>
+
+#include <react/renderer/graphics/Float.h>
+#include <react/renderer/graphics/Point.h>
+
+namespace facebook::react {
+
+/*
+ * Latest content offset of a <ScrollView>, published by the mounting layer
+ * while the user scrolls. One instance is shared by all states of a
+ * ScrollView family, so the offset can be updated many times per second
+ * without committing a new state (and running layout and diffing) for each
+ * scroll event.
+ * Can be written and read from any thread without locking.
+ */
+class ScrollViewContentOffset final {
+ public:
+  /*
+   * Publishes a new content offset.
+   */
+  void set(Point contentOffset) noexcept;
+
+  /*
+   * Returns the most recently published content offset, or nothing if no
+   * offset was published yet.
+   */
+  std::optional<Point> get() const noexcept;
+
+ private:
+  /*
+   * Sequence lock guarding `x_` and `y_`: odd while a write is in progress,
+   * zero until the first write.
+   */
+  std::atomic<uint64_t> sequence_{0};
+  std::atomic<Float> x_{0};
+  std::atomic<Float> y_{0};
+};
+
+} // namespace facebook::react
@@ -64,8 +64,8 @@ void ScrollViewShadowNode::layout(LayoutContext layoutContext) {
 }
 
 Point ScrollViewShadowNode::getContentOriginOffset() const {
-  auto stateData = getStateData();
-  auto contentOffset = stateData.contentOffset;
+  const auto& stateData = getStateData();
+  auto contentOffset = stateData.getContentOffset();
   return {-contentOffset.x, -contentOffset.y + stateData.scrollAwayPaddingTop};
 }
 
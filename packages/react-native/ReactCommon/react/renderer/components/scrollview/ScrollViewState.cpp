@@ -15,10 +15,20 @@ ScrollViewState::ScrollViewState(
     int scrollAwayPaddingTop)
     : contentOffset(contentOffset),
       contentBoundingRect(contentBoundingRect),
-      scrollAwayPaddingTop(scrollAwayPaddingTop) {}
+      scrollAwayPaddingTop(scrollAwayPaddingTop),
+      latestContentOffset(std::make_shared<ScrollViewContentOffset>()) {}
 
 Size ScrollViewState::getContentSize() const {
   return contentBoundingRect.size;
 }
 
+Point ScrollViewState::getContentOffset() const {
+  if (latestContentOffset) {
+    if (auto latest = latestContentOffset->get()) {
+      return *latest;
+    }
+  }
+  return contentOffset;
+}
+
 } // namespace facebook::react
@@ -7,6 +7,9 @@
 
 #pragma once
 
+#include <memory>
+
+#include <react/renderer/components/scrollview/ScrollViewContentOffset.h>
 #include <react/renderer/graphics/Float.h>
 #include <react/renderer/graphics/Point.h>
 #include <react/renderer/graphics/Rect.h>
@@ -35,22 +38,51 @@ class ScrollViewState final {
   Rect contentBoundingRect;
   int scrollAwayPaddingTop;
 
+  /*
+   * Content offset published by the mounting layer without a commit. Shared
+   * by all states of the family; may be newer than `contentOffset`.
+   */
+  std::shared_ptr<ScrollViewContentOffset> latestContentOffset;
+
   /*
    * Returns size of scrollable area.
    */
   Size getContentSize() const;
 
+  /*
+   * Returns the most recent content offset: the one published through
+   * `latestContentOffset` if any, `contentOffset` otherwise.
+   */
+  Point getContentOffset() const;
+
 #ifdef ANDROID
   ScrollViewState(const ScrollViewState& previousState, folly::dynamic data)
       : contentOffset(
             {(Float)data["contentOffsetLeft"].getDouble(),
              (Float)data["contentOffsetTop"].getDouble()}),
         contentBoundingRect({}),
-        scrollAwayPaddingTop((Float)data["scrollAwayPaddingTop"].getDouble()){};
+        scrollAwayPaddingTop((Float)data["scrollAwayPaddingTop"].getDouble()),
+        latestContentOffset(previousState.latestContentOffset) {
+    if (latestContentOffset) {
+      latestContentOffset->set(contentOffset);
+    }
+  };
+
+  /*
+   * Layout does not depend on the content offset, which is published through
+   * `latestContentOffset` already, so only a change of the scroll-away
+   * padding needs to be committed.
+   */
+  bool requiresCommit(const ScrollViewState& previousState) const {
+    return !latestContentOffset ||
+        scrollAwayPaddingTop != previousState.scrollAwayPaddingTop;
+  }
 
   folly::dynamic getDynamic() const {
-    return folly::dynamic::object("contentOffsetLeft", contentOffset.x)(
-        "contentOffsetTop", contentOffset.y)(
+    // `contentOffset` may be stale; the shared latest offset is not.
+    auto offset = getContentOffset();
+    return folly::dynamic::object("contentOffsetLeft", offset.x)(
+        "contentOffsetTop", offset.y)(
         "scrollAwayPaddingTop", scrollAwayPaddingTop);
   };
   MapBuffer getMapBuffer() const {
@@ -5,10 +5,174 @@
  * LICENSE file in the root directory of this source tree.
  */
 
+#include <atomic>
 #include <memory>
+#include <string>
+#include <thread>
 
 #include <gtest/gtest.h>
+#include <react/renderer/components/scrollview/ScrollViewComponentDescriptor.h>
+#include <react/renderer/components/scrollview/ScrollViewContentOffset.h>
+#include <react/renderer/components/scrollview/ScrollViewState.h>
+#include <react/renderer/core/EventDispatcher.h>
+
+using namespace facebook::react;
+
+namespace {
+
+/*
+ * The event queue requests a beat for every state update dispatched to it;
+ * each of them would end up in a commit.
+ */
+class CountingEventBeat : public EventBeat {
+ public:
+  CountingEventBeat(SharedOwnerBox ownerBox, int& requestCount)
+      : EventBeat(std::move(ownerBox)), requestCount_(requestCount) {}
+
+  void request() const override {
+    requestCount_++;
+    EventBeat::request();
+  }
+
+ private:
+  int& requestCount_;
+};
+
+} // namespace
+
+class ScrollViewStateUpdateTest : public ::testing::Test {
+ protected:
+  ScrollViewStateUpdateTest() {
+    auto eventBeatFactory = [this](const EventBeat::SharedOwnerBox& ownerBox) {
+      return std::make_unique<CountingEventBeat>(ownerBox, stateUpdateCount_);
+    };
+    eventDispatcher_ = std::make_shared<const EventDispatcher>(
+        EventQueueProcessor(
+            [](jsi::Runtime& /*runtime*/,
+               const EventTarget* /*eventTarget*/,
+               const std::string& /*type*/,
+               ReactEventPriority /*priority*/,
+               const EventPayload& /*payload*/) {},
+            [](jsi::Runtime& /*runtime*/) {},
+            [](const StateUpdate& /*stateUpdate*/) {}),
+        eventBeatFactory,
+        eventBeatFactory,
+        std::make_shared<EventBeat::OwnerBox>());
+    componentDescriptor_ = std::make_shared<ScrollViewComponentDescriptor>(
+        ComponentDescriptorParameters{eventDispatcher_, nullptr, nullptr});
+
+    auto family = componentDescriptor_->createFamily(ShadowNodeFamilyFragment{
+        /* .tag = */ 11,
+        /* .surfaceId = */ 1,
+        /* .instanceHandle = */ nullptr,
+    });
+    state_ =
+        std::static_pointer_cast<const ScrollViewShadowNode::ConcreteState>(
+            componentDescriptor_->createInitialState(
+                std::make_shared<const ScrollViewProps>(), family));
+  }
+
+  /*
+   * Reports a new content offset the way the mounting layer of the platform
+   * does.
+   */
+  void scrollTo(Point contentOffset, int scrollAwayPaddingTop = 0) {
+#ifdef ANDROID
+    state_->updateState(
+        folly::dynamic::object("contentOffsetLeft", contentOffset.x)(
+            "contentOffsetTop", contentOffset.y)(
+            "scrollAwayPaddingTop", scrollAwayPaddingTop));
+#else
+    (void)scrollAwayPaddingTop;
+    state_->getData().latestContentOffset->set(contentOffset);
+#endif
+  }
+
+  int stateUpdateCount_{0};
+  EventDispatcher::Shared eventDispatcher_;
+  std::shared_ptr<const ScrollViewComponentDescriptor> componentDescriptor_;
+  ScrollViewShadowNode::ConcreteState::Shared state_;
+};
 
 TEST(ScrollViewTest, testSomething) {
   // TODO
 }
+
+TEST(ScrollViewTest, contentOffsetIsEmptyUntilPublished) {
+  auto contentOffset = ScrollViewContentOffset{};
+  EXPECT_FALSE(contentOffset.get().has_value());
+
+  contentOffset.set({10, 20});
+  EXPECT_EQ(contentOffset.get(), (Point{10, 20}));
+
+  contentOffset.set({0, 0});
+  EXPECT_EQ(contentOffset.get(), (Point{0, 0}));
+}
+
+TEST(ScrollViewTest, stateReadsPublishedContentOffset) {
+  auto state = ScrollViewState{{5, 6}, {}, 0};
+  EXPECT_EQ(state.getContentOffset(), (Point{5, 6}));
+
+  // Copies of the state data share the slot, like all states of a family do.
+  auto nextState = state;
+  nextState.contentBoundingRect = {{0, 0}, {100, 1000}};
+
+  state.latestContentOffset->set({0, 300});
+  EXPECT_EQ(state.getContentOffset(), (Point{0, 300}));
+  EXPECT_EQ(nextState.getContentOffset(), (Point{0, 300}));
+  EXPECT_EQ(nextState.contentOffset, (Point{5, 6}));
+}
+
+TEST(ScrollViewTest, stateWithoutSlotReadsCommittedContentOffset) {
+  auto state = ScrollViewState{};
+  state.contentOffset = {1, 2};
+  EXPECT_EQ(state.getContentOffset(), (Point{1, 2}));
+}
+
+TEST_F(ScrollViewStateUpdateTest, stateUpdatesAreDispatched) {
+  auto data = state_->getData();
+  data.contentBoundingRect = {{0, 0}, {100, 1000}};
+  state_->updateState(std::move(data));
+
+  EXPECT_EQ(stateUpdateCount_, 1);
+}
+
+#ifdef ANDROID
+TEST_F(ScrollViewStateUpdateTest, onlyScrollAwayPaddingChangesAreCommitted) {
+  scrollTo({0, 100});
+  EXPECT_EQ(stateUpdateCount_, 0);
+  EXPECT_EQ(state_->getData().getContentOffset(), (Point{0, 100}));
+
+  scrollTo({0, 100}, 50);
+  EXPECT_EQ(stateUpdateCount_, 1);
+}
+#endif
+
+/*
+ * Simulates ten seconds of scrolling at 120 Hz while another thread keeps
+ * reading the offset, the way `measure` does from the JavaScript thread.
+ * Every read must observe a pair of coordinates that was written together,
+ * and none of the updates may be committed.
+ */
+TEST_F(ScrollViewStateUpdateTest, scrollingDoesNotCommitState) {
+  constexpr int kScrollEvents = 10 * 120;
+
+  auto done = std::atomic<bool>{false};
+  auto reader = std::thread([&] {
+    while (!done.load()) {
+      auto offset = state_->getData().getContentOffset();
+      ASSERT_EQ(offset.y, offset.x * 2);
+    }
+  });
+
+  for (int i = 0; i < kScrollEvents; i++) {
+    scrollTo({Float(i), Float(i) * 2});
+  }
+  done = true;
+  reader.join();
+
+  EXPECT_EQ(stateUpdateCount_, 0);
+  EXPECT_EQ(
+      state_->getData().getContentOffset(),
+      (Point{kScrollEvents - 1, (kScrollEvents - 1) * 2}));
+}
@@ -13,6 +13,7 @@
 #include <react/debug/react_native_assert.h>
 #include <react/renderer/core/ComponentDescriptor.h>
 #include <react/renderer/core/EventDispatcher.h>
+#include <react/renderer/core/ParsedPropsCache.h>
 #include <react/renderer/core/Props.h>
 #include <react/renderer/core/PropsParserContext.h>
 #include <react/renderer/core/ShadowNode.h>
@@ -111,6 +112,30 @@ class ConcreteComponentDescriptor : public ComponentDescriptor {
 
     rawProps.parse(rawPropsParser_);
 
+    // Optimization:
+    // Nodes are often created with exactly the same props (e.g. list cells
+    // sharing a style). Props parsed from scratch are cached by their raw
+    // values once the values repeat, and nodes with the same values copy them
+    // instead of parsing. The cached object is never handed out because some
+    // props objects are mutated after they are created.
+    if (CoreFeatures::cacheParsedProps && !props &&
+        !CoreFeatures::enablePropIteratorSetter &&
+        ParsedPropsCache::isCacheable(rawProps)) {
+      auto lookup = parsedPropsCache_.get(context, rawProps);
+      if (lookup.props) {
+        return copyProps(context, lookup.props);
+      }
+
+      auto shadowNodeProps = ShadowNodeT::Props(context, rawProps, nullptr);
+      if (!lookup.isRepeated) {
+        return shadowNodeProps;
+      }
+
+      // The props just parsed become the cached ones; the node gets a copy.
+      parsedPropsCache_.set(lookup, context, rawProps, shadowNodeProps);
+      return copyProps(context, shadowNodeProps);
+    }
+
     // Call old-style constructor
     auto shadowNodeProps = ShadowNodeT::Props(context, rawProps, props);
 
@@ -128,6 +153,13 @@ class ConcreteComponentDescriptor : public ComponentDescriptor {
     return shadowNodeProps;
   };
 
+  /*
+   * Returns hit and miss counts of the cache of props parsed from scratch.
+   */
+  ParsedPropsCache::Stats getParsedPropsCacheStats() const {
+    return parsedPropsCache_.getStats();
+  }
+
   virtual State::Shared createInitialState(
       const Props::Shared& props,
       const ShadowNodeFamily::Shared& family) const override {
@@ -159,11 +191,14 @@ class ConcreteComponentDescriptor : public ComponentDescriptor {
 
   ShadowNodeFamily::Shared createFamily(
       const ShadowNodeFamilyFragment& fragment) const override {
+    auto eventDispatcher = fragment.eventDispatcher
+        ? EventDispatcher::Weak{fragment.eventDispatcher}
+        : eventDispatcher_;
     auto eventEmitter = std::make_shared<const ConcreteEventEmitter>(
         std::make_shared<EventTarget>(fragment.instanceHandle),
-        eventDispatcher_);
+        eventDispatcher);
     return std::make_shared<ShadowNodeFamily>(
-        fragment, std::move(eventEmitter), eventDispatcher_, *this);
+        fragment, std::move(eventEmitter), eventDispatcher, *this);
   }
 
  protected:
@@ -172,6 +207,25 @@ class ConcreteComponentDescriptor : public ComponentDescriptor {
     react_native_assert(
         shadowNode.getComponentHandle() == getComponentHandle());
   }
+
+ private:
+  /*
+   * Props are not copy-constructible; parsing empty raw props on top of
+   * `props` copies them.
+   */
+  SharedConcreteProps copyProps(
+      const PropsParserContext& context,
+      const Props::Shared& props) const {
+    RawProps emptyRawProps{};
+    emptyRawProps.parse(rawPropsParser_);
+    auto copiedProps = ShadowNodeT::Props(context, emptyRawProps, props);
+#ifdef ANDROID
+    copiedProps->rawProps = props->rawProps;
+#endif
+    return copiedProps;
+  }
+
+  ParsedPropsCache parsedPropsCache_;
 };
 
 } // namespace facebook::react
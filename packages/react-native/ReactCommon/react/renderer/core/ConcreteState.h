@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <concepts>
 #include <functional>
 #include <memory>
 
@@ -97,7 +98,19 @@ class ConcreteState : public State {
   }
 
   void updateState(folly::dynamic&& data) const override {
-    updateState(Data(getData(), std::move(data)));
+    auto newData = Data(getData(), std::move(data));
+
+    // Data types can opt out of committing updates that only touch values
+    // they already publish to the shadow tree some other way.
+    if constexpr (requires {
+                    { newData.requiresCommit(getData()) } -> std::same_as<bool>;
+                  }) {
+      if (!newData.requiresCommit(getData())) {
+        return;
+      }
+    }
+
+    updateState(std::move(newData));
   }
 
   MapBuffer getMapBuffer() const override {
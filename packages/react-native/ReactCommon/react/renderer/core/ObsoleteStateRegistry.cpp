@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ObsoleteStateRegistry.h"
+
+namespace facebook::react {
+
+ObsoleteStateRegistry& ObsoleteStateRegistry::shared() {
+  // Intentionally leaked: families may go away while static destructors run.
+  static auto* registry = new ObsoleteStateRegistry();
+  return *registry;
+}
+
+void ObsoleteStateRegistry::add(const ShadowNodeFamily::Shared& family) {
+  std::scoped_lock lock(mutex_);
+  entries_[family->getSurfaceId()][family.get()] =
+      WeakEntry{family, nextGeneration_++};
+}
+
+std::vector<ObsoleteStateRegistry::Entry> ObsoleteStateRegistry::get(
+    SurfaceId surfaceId) {
+  std::scoped_lock lock(mutex_);
+  auto it = entries_.find(surfaceId);
+  if (it == entries_.end()) {
+    return {};
+  }
+
+  auto& surfaceEntries = it->second;
+  auto result = std::vector<Entry>{};
+  result.reserve(surfaceEntries.size());
+  for (auto entryIt = surfaceEntries.begin();
+       entryIt != surfaceEntries.end();) {
+    auto family = entryIt->second.family.lock();
+    if (!family) {
+      entryIt = surfaceEntries.erase(entryIt);
+      continue;
+    }
+    result.push_back(Entry{std::move(family), entryIt->second.generation});
+    entryIt++;
+  }
+
+  if (surfaceEntries.empty()) {
+    entries_.erase(it);
+  }
+  return result;
+}
+
+void ObsoleteStateRegistry::remove(const Entry& entry) {
+  std::scoped_lock lock(mutex_);
+  auto it = entries_.find(entry.family->getSurfaceId());
+  if (it == entries_.end()) {
+    return;
+  }
+
+  auto& surfaceEntries = it->second;
+  auto entryIt = surfaceEntries.find(entry.family.get());
+  if (entryIt == surfaceEntries.end() ||
+      entryIt->second.generation != entry.generation) {
+    return;
+  }
+
+  surfaceEntries.erase(entryIt);
+  if (surfaceEntries.empty()) {
+    entries_.erase(it);
+  }
+}
+
+void ObsoleteStateRegistry::removeSurface(SurfaceId surfaceId) {
+  std::scoped_lock lock(mutex_);
+  entries_.erase(surfaceId);
+}
+
+} // namespace facebook::react
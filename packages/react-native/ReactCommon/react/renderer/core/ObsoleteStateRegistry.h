@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include <react/renderer/core/ReactPrimitives.h>
+#include <react/renderer/core/ShadowNodeFamily.h>
+
+namespace facebook::react {
+
+/*
+ * Keeps track of the families whose committed `State` was superseded by a
+ * newer one, grouped by surface.
+ * State reconciliation only has to visit the nodes of these families instead
+ * of walking the whole tree looking for obsolete `State` objects.
+ * Entries hold families weakly. They are pruned when their family is gone,
+ * when a committed tree is up to date with the family (see
+ * `ShadowTree::tryCommit`), and when the surface is stopped.
+ * Thread-safe.
+ */
+class ObsoleteStateRegistry final {
+ public:
+  struct Entry {
+    ShadowNodeFamily::Shared family;
+
+    /*
+     * Changes every time the family is registered again, so an entry can be
+     * removed without losing a registration that happened in the meantime.
+     */
+    uint64_t generation;
+  };
+
+  /*
+   * Process-wide instance.
+   */
+  static ObsoleteStateRegistry& shared();
+
+  /*
+   * Registers a family whose most recent `State` changed.
+   * To be used by `ShadowNodeFamily` only.
+   */
+  void add(const ShadowNodeFamily::Shared& family);
+
+  /*
+   * Returns the registered families of the given surface.
+   */
+  std::vector<Entry> get(SurfaceId surfaceId);
+
+  /*
+   * Removes the entry unless the family was registered again since `entry`
+   * was returned by `get`.
+   */
+  void remove(const Entry& entry);
+
+  /*
+   * Removes all entries of the given surface. Families are allocated together
+   * with their control blocks, so entries must not outlive the surface.
+   * To be used by `ShadowTree` only.
+   */
+  void removeSurface(SurfaceId surfaceId);
+
+ private:
+  struct WeakEntry {
+    ShadowNodeFamily::Weak family;
+    uint64_t generation;
+  };
+
+  std::mutex mutex_;
+  std::unordered_map<
+      SurfaceId,
+      std::unordered_map<const ShadowNodeFamily*, WeakEntry>>
+      entries_;
+  uint64_t nextGeneration_{0};
+};
+
+} // namespace facebook::react
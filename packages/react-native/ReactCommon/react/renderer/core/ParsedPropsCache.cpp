@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ParsedPropsCache.h"
+
+#include <folly/hash/Hash.h>
+
+namespace facebook::react {
+
+ParsedPropsCache::ParsedPropsCache(size_t capacity)
+    : capacity_(capacity), recentMisses_(capacity * 4, 0) {}
+
+bool ParsedPropsCache::isCacheable(const RawProps& rawProps) noexcept {
+  // A parser that does not know any keys (e.g. for props that are set via
+  // `setProp`) leaves nothing to compare.
+  return rawProps.parser_ != nullptr &&
+      rawProps.mode_ != RawProps::Mode::Empty &&
+      !rawProps.keyIndexToValueIndex_.empty() && !rawProps.hasIgnoredValues_;
+}
+
+size_t ParsedPropsCache::hash(
+    const PropsParserContext& context,
+    const RawProps& rawProps) {
+  auto result = folly::hash::hash_combine(context.surfaceId);
+  const auto& keyIndexToValueIndex = rawProps.keyIndexToValueIndex_;
+  for (size_t keyIndex = 0; keyIndex < keyIndexToValueIndex.size();
+       keyIndex++) {
+    auto valueIndex = keyIndexToValueIndex[keyIndex];
+    if (valueIndex == kRawPropsValueIndexEmpty) {
+      continue;
+    }
+    result = folly::hash::hash_combine(
+        result, keyIndex, rawProps.values_[valueIndex].dynamic_.hash());
+  }
+  return result;
+}
+
+bool ParsedPropsCache::matches(
+    const Entry& entry,
+    const PropsParserContext& context,
+    const RawProps& rawProps) {
+  if (entry.surfaceId != context.surfaceId ||
+      entry.values.size() != rawProps.values_.size()) {
+    return false;
+  }
+
+  for (const auto& [keyIndex, value] : entry.values) {
+    auto valueIndex = rawProps.keyIndexToValueIndex_[keyIndex];
+    if (valueIndex == kRawPropsValueIndexEmpty ||
+        rawProps.values_[valueIndex].dynamic_ != value) {
+      return false;
+    }
+  }
+  return true;
+}
+
+ParsedPropsCache::Lookup ParsedPropsCache::get(
+    const PropsParserContext& context,
+    const RawProps& rawProps) const {
+  auto key = hash(context, rawProps);
+
+  std::scoped_lock lock(mutex_);
+  auto it = entriesByHash_.find(key);
+  if (it == entriesByHash_.end() || !matches(*it->second, context, rawProps)) {
+    stats_.misses++;
+    auto isRepeated = false;
+    if (!recentMisses_.empty()) {
+      auto& recentMiss = recentMisses_[key % recentMisses_.size()];
+      isRepeated = recentMiss == key;
+      recentMiss = key;
+    }
+    return {key, nullptr, isRepeated};
+  }
+
+  stats_.hits++;
+  entries_.splice(entries_.begin(), entries_, it->second);
+  return {key, it->second->props, false};
+}
+
+void ParsedPropsCache::set(
+    const Lookup& lookup,
+    const PropsParserContext& context,
+    const RawProps& rawProps,
+    Props::Shared props) const {
+  if (capacity_ == 0) {
+    return;
+  }
+
+  auto key = lookup.hash;
+
+  auto values = Values{};
+  values.reserve(rawProps.values_.size());
+  const auto& keyIndexToValueIndex = rawProps.keyIndexToValueIndex_;
+  for (size_t keyIndex = 0; keyIndex < keyIndexToValueIndex.size();
+       keyIndex++) {
+    auto valueIndex = keyIndexToValueIndex[keyIndex];
+    if (valueIndex != kRawPropsValueIndexEmpty) {
+      values.emplace_back(
+          static_cast<RawPropsValueIndex>(keyIndex),
+          rawProps.values_[valueIndex].dynamic_);
+    }
+  }
+
+  std::scoped_lock lock(mutex_);
+  auto it = entriesByHash_.find(key);
+  if (it != entriesByHash_.end()) {
+    // Same hash, but different values (or the same values cached by a
+    // concurrent caller); the newer entry wins.
+    entries_.erase(it->second);
+    entriesByHash_.erase(it);
+  }
+
+  entries_.push_front(
+      Entry{key, context.surfaceId, std::move(values), std::move(props)});
+  entriesByHash_.emplace(key, entries_.begin());
+
+  if (entries_.size() > capacity_) {
+    entriesByHash_.erase(entries_.back().hash);
+    entries_.pop_back();
+  }
+}
+
+ParsedPropsCache::Stats ParsedPropsCache::getStats() const {
+  std::scoped_lock lock(mutex_);
+  return stats_;
+}
+
+} // namespace facebook::react
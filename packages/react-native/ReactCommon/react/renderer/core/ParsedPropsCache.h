@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <folly/dynamic.h>
+#include <react/renderer/core/Props.h>
+#include <react/renderer/core/PropsParserContext.h>
+#include <react/renderer/core/RawProps.h>
+#include <react/renderer/core/RawPropsPrimitives.h>
+
+namespace facebook::react {
+
+/*
+ * Bounded LRU cache of `Props` objects parsed from scratch (i.e. not on top of
+ * some previous props), keyed by the values of the `RawProps` they were parsed
+ * from. Many nodes are created with exactly the same props (e.g. list cells
+ * sharing a style); once the values repeat, the following nodes can copy the
+ * cached `Props` instead of converting every value again.
+ * Only `RawProps` that contain nothing but values known to the parser can be
+ * cached, so that the cached `Props` describe them completely.
+ * The class is thread-safe.
+ */
+class ParsedPropsCache final {
+ public:
+  struct Stats {
+    size_t hits{0};
+    size_t misses{0};
+  };
+
+  /*
+   * Result of `get`. On a miss, `isRepeated` tells if the same values missed
+   * recently, i.e. if caching props parsed from them is likely to pay off.
+   */
+  struct Lookup {
+    size_t hash;
+    Props::Shared props;
+    bool isRepeated;
+  };
+
+  static constexpr size_t kDefaultCapacity = 64;
+
+  explicit ParsedPropsCache(size_t capacity = kDefaultCapacity);
+
+  /*
+   * Returns `true` if props parsed from given (already preparsed) `RawProps`
+   * can be cached.
+   */
+  static bool isCacheable(const RawProps& rawProps) noexcept;
+
+  /*
+   * Looks up props parsed from `RawProps` with identical values.
+   * `rawProps` must be cacheable.
+   * The returned object must not be handed out; copy it instead.
+   */
+  Lookup get(const PropsParserContext& context, const RawProps& rawProps)
+      const;
+
+  /*
+   * Caches `props` parsed from `rawProps`, which missed in `lookup`.
+   * `rawProps` must be cacheable, and `props` must not be shared with
+   * anything that can mutate it.
+   */
+  void set(
+      const Lookup& lookup,
+      const PropsParserContext& context,
+      const RawProps& rawProps,
+      Props::Shared props) const;
+
+  Stats getStats() const;
+
+ private:
+  using Values = std::vector<std::pair<RawPropsValueIndex, folly::dynamic>>;
+
+  struct Entry {
+    size_t hash;
+    SurfaceId surfaceId;
+    Values values;
+    Props::Shared props;
+  };
+
+  using Entries = std::list<Entry>;
+
+  static size_t hash(const PropsParserContext& context, const RawProps& rawProps);
+
+  static bool matches(
+      const Entry& entry,
+      const PropsParserContext& context,
+      const RawProps& rawProps);
+
+  size_t capacity_;
+  mutable std::mutex mutex_;
+  mutable Stats stats_;
+  // Hashes of recent misses, indexed by hash. Values are only cached once
+  // they miss twice, so that props which are never repeated only cost a hash.
+  mutable std::vector<size_t> recentMisses_;
+  // Most recently used first.
+  mutable Entries entries_;
+  mutable std::unordered_map<size_t, Entries::iterator> entriesByHash_;
+};
+
+} // namespace facebook::react
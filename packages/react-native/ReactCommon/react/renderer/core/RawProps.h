@@ -105,6 +105,7 @@ class RawProps final {
 
  private:
   friend class RawPropsParser;
+  friend class ParsedPropsCache;
 
   mutable const RawPropsParser* parser_{nullptr};
 
@@ -134,6 +135,12 @@ class RawProps final {
   mutable std::vector<RawPropsValueIndex> keyIndexToValueIndex_;
   mutable std::vector<RawValue> values_;
 
+  /*
+   * Whether the source data has values that the parser does not know about
+   * (and hence are not in `values_`).
+   */
+  mutable bool hasIgnoredValues_{false};
+
   bool ignoreYogaStyleProps_{false};
 };
 
@@ -133,6 +133,7 @@ void RawPropsParser::preparse(const RawProps& rawProps) const noexcept {
             name.data(), static_cast<RawPropsPropNameLength>(name.size()));
 
         if (keyIndex == kRawPropsValueIndexEmpty) {
+          rawProps.hasIgnoredValues_ = true;
           continue;
         }
 
@@ -156,6 +157,7 @@ void RawPropsParser::preparse(const RawProps& rawProps) const noexcept {
             name.data(), static_cast<RawPropsPropNameLength>(name.size()));
 
         if (keyIndex == kRawPropsValueIndexEmpty) {
+          rawProps.hasIgnoredValues_ = true;
           continue;
         }
 
@@ -68,6 +68,7 @@ class RawValue {
  private:
   friend class RawProps;
   friend class RawPropsParser;
+  friend class ParsedPropsCache;
   friend class UIManagerBinding;
 
   /*
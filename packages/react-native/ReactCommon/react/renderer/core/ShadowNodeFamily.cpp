@@ -10,6 +10,7 @@
 
 #include <react/debug/react_native_assert.h>
 #include <react/renderer/core/ComponentDescriptor.h>
+#include <react/renderer/core/ObsoleteStateRegistry.h>
 #include <react/renderer/core/State.h>
 
 #include <utility>
@@ -122,6 +123,9 @@ void ShadowNodeFamily::setMostRecentState(const State::Shared& state) const {
 
   if (mostRecentState_) {
     mostRecentState_->isObsolete_ = true;
+    if (auto family = weak_from_this().lock()) {
+      ObsoleteStateRegistry::shared().add(family);
+    }
   }
 
   mostRecentState_ = state;
@@ -33,13 +33,20 @@ struct ShadowNodeFamilyFragment {
   const Tag tag;
   const SurfaceId surfaceId;
   const std::shared_ptr<const InstanceHandle> instanceHandle;
+  /*
+   * Dispatches the events and state updates of the family instead of the
+   * `EventDispatcher` of the `ComponentDescriptor` when set. Used by surfaces
+   * rendered by another runtime than the one the `UIManager` belongs to.
+   */
+  const EventDispatcher::Shared eventDispatcher{};
 };
 
 /*
  * Represents all things that shadow nodes from the same family have in common.
  * To be used inside `ShadowNode` class *only*.
  */
-class ShadowNodeFamily final {
+class ShadowNodeFamily final
+    : public std::enable_shared_from_this<ShadowNodeFamily> {
  public:
   using Shared = std::shared_ptr<const ShadowNodeFamily>;
   using Weak = std::weak_ptr<const ShadowNodeFamily>;
@@ -89,6 +96,8 @@ class ShadowNodeFamily final {
 
   /*
    * Sets and gets the most recent state.
+   * Replacing a state marks it obsolete and registers the family in
+   * `ObsoleteStateRegistry`.
    */
   std::shared_ptr<const State> getMostRecentState() const;
   void setMostRecentState(const std::shared_ptr<State const>& state) const;
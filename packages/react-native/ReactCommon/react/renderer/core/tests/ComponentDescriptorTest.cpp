@@ -7,12 +7,54 @@
 
 #include <gtest/gtest.h>
 
+#include <react/renderer/core/EventDispatcher.h>
 #include <react/renderer/core/PropsParserContext.h>
+#include <react/utils/CoreFeatures.h>
 
 #include "TestComponent.h"
 
 using namespace facebook::react;
 
+namespace {
+
+class CountingEventBeat : public EventBeat {
+ public:
+  CountingEventBeat(SharedOwnerBox ownerBox, int& requestCount)
+      : EventBeat(std::move(ownerBox)), requestCount_(requestCount) {}
+
+  void request() const override {
+    requestCount_++;
+    EventBeat::request();
+  }
+
+ private:
+  int& requestCount_;
+};
+
+/*
+ * Creates a dispatcher which counts the state updates dispatched to it.
+ */
+EventDispatcher::Shared countingEventDispatcher(int& stateUpdateCount) {
+  auto eventBeatFactory =
+      [&stateUpdateCount](const EventBeat::SharedOwnerBox& ownerBox) {
+        return std::make_unique<CountingEventBeat>(ownerBox, stateUpdateCount);
+      };
+  return std::make_shared<const EventDispatcher>(
+      EventQueueProcessor(
+          [](jsi::Runtime& /*runtime*/,
+             const EventTarget* /*eventTarget*/,
+             const std::string& /*type*/,
+             ReactEventPriority /*priority*/,
+             const EventPayload& /*payload*/) {},
+          [](jsi::Runtime& /*runtime*/) {},
+          [](const StateUpdate& /*stateUpdate*/) {}),
+      eventBeatFactory,
+      eventBeatFactory,
+      std::make_shared<EventBeat::OwnerBox>());
+}
+
+} // namespace
+
 TEST(ComponentDescriptorTest, createShadowNode) {
   auto eventDispatcher = std::shared_ptr<const EventDispatcher>();
   SharedComponentDescriptor descriptor =
@@ -135,3 +177,111 @@ TEST(ComponentDescriptorTest, appendChild) {
   EXPECT_EQ(node1Children.at(0), node2);
   EXPECT_EQ(node1Children.at(1), node3);
 }
+
+TEST(ComponentDescriptorTest, reuseParsedProps) {
+  CoreFeatures::cacheParsedProps = true;
+  auto eventDispatcher = std::shared_ptr<const EventDispatcher>();
+  auto descriptor = std::make_shared<TestComponentDescriptor>(
+      ComponentDescriptorParameters{eventDispatcher, nullptr, nullptr});
+
+  ContextContainer contextContainer{};
+  PropsParserContext parserContext{-1, contextContainer};
+
+  auto rawPropsValue = folly::dynamic::object("nativeID", "abc")("flex", 1);
+  auto props = std::static_pointer_cast<const TestProps>(descriptor->cloneProps(
+      parserContext, nullptr, RawProps(rawPropsValue)));
+
+  // Values are cached once they repeat.
+  auto stats = descriptor->getParsedPropsCacheStats();
+  EXPECT_EQ(stats.misses, 1);
+  descriptor->cloneProps(parserContext, nullptr, RawProps(rawPropsValue));
+  stats = descriptor->getParsedPropsCacheStats();
+  EXPECT_EQ(stats.hits, 0);
+  EXPECT_EQ(stats.misses, 2);
+
+  auto otherProps =
+      std::static_pointer_cast<const TestProps>(descriptor->cloneProps(
+          parserContext, nullptr, RawProps(rawPropsValue)));
+
+  // Props parsed from identical values are equal but not shared.
+  EXPECT_NE(props, otherProps);
+  EXPECT_EQ(otherProps->nativeId, "abc");
+  EXPECT_EQ(otherProps->yogaStyle, props->yogaStyle);
+
+  stats = descriptor->getParsedPropsCacheStats();
+  EXPECT_EQ(stats.hits, 1);
+  EXPECT_EQ(stats.misses, 2);
+
+  // Values the parser does not know about disable the cache.
+  descriptor->cloneProps(
+      parserContext,
+      nullptr,
+      RawProps(folly::dynamic::object("nativeID", "abc")("unknown", 1)));
+  // So does parsing on top of existing props.
+  descriptor->cloneProps(parserContext, props, RawProps(rawPropsValue));
+
+  stats = descriptor->getParsedPropsCacheStats();
+  EXPECT_EQ(stats.hits, 1);
+  EXPECT_EQ(stats.misses, 2);
+
+  auto differentProps =
+      std::static_pointer_cast<const TestProps>(descriptor->cloneProps(
+          parserContext,
+          nullptr,
+          RawProps(folly::dynamic::object("nativeID", "abc")("flex", 2))));
+  EXPECT_NE(differentProps->yogaStyle, props->yogaStyle);
+  EXPECT_EQ(descriptor->getParsedPropsCacheStats().misses, 3);
+  CoreFeatures::cacheParsedProps = false;
+}
+
+TEST(ComponentDescriptorTest, parsedPropsAreNotCachedByDefault) {
+  auto eventDispatcher = std::shared_ptr<const EventDispatcher>();
+  auto descriptor = std::make_shared<TestComponentDescriptor>(
+      ComponentDescriptorParameters{eventDispatcher, nullptr, nullptr});
+
+  ContextContainer contextContainer{};
+  PropsParserContext parserContext{-1, contextContainer};
+
+  auto rawPropsValue = folly::dynamic::object("nativeID", "abc");
+  descriptor->cloneProps(parserContext, nullptr, RawProps(rawPropsValue));
+  descriptor->cloneProps(parserContext, nullptr, RawProps(rawPropsValue));
+
+  auto stats = descriptor->getParsedPropsCacheStats();
+  EXPECT_EQ(stats.hits, 0);
+  EXPECT_EQ(stats.misses, 0);
+}
+
+TEST(ComponentDescriptorTest, createFamilyWithEventDispatcher) {
+  int descriptorStateUpdates = 0;
+  int fragmentStateUpdates = 0;
+  auto descriptorEventDispatcher =
+      countingEventDispatcher(descriptorStateUpdates);
+  auto fragmentEventDispatcher = countingEventDispatcher(fragmentStateUpdates);
+  SharedComponentDescriptor descriptor =
+      std::make_shared<TestComponentDescriptor>(ComponentDescriptorParameters{
+          descriptorEventDispatcher, nullptr, nullptr});
+
+  auto dispatchStateUpdate = [](const ShadowNodeFamily& family) {
+    family.dispatchRawState(
+        {nullptr, [](const StateData::Shared& data) { return data; }});
+  };
+
+  auto family = descriptor->createFamily(ShadowNodeFamilyFragment{
+      /* .tag = */ 9,
+      /* .surfaceId = */ 1,
+      /* .instanceHandle = */ nullptr,
+  });
+  dispatchStateUpdate(*family);
+  EXPECT_EQ(descriptorStateUpdates, 1);
+  EXPECT_EQ(fragmentStateUpdates, 0);
+
+  auto overriddenFamily = descriptor->createFamily(ShadowNodeFamilyFragment{
+      /* .tag = */ 10,
+      /* .surfaceId = */ 2,
+      /* .instanceHandle = */ nullptr,
+      /* .eventDispatcher = */ fragmentEventDispatcher,
+  });
+  dispatchStateUpdate(*overriddenFamily);
+  EXPECT_EQ(descriptorStateUpdates, 1);
+  EXPECT_EQ(fragmentStateUpdates, 1);
+}
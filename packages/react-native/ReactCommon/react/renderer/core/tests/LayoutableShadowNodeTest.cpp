@@ -274,6 +274,63 @@ TEST_P(LayoutableShadowNodeTest, contentOriginOffset) {
   EXPECT_EQ(relativeLayoutMetrics.frame.origin.y, 20);
 }
 
+/*
+ * Same tree as above, but the content offset is published by the mounting
+ * layer instead of being committed with a new state.
+ */
+TEST_P(LayoutableShadowNodeTest, publishedContentOriginOffset) {
+  auto scrollViewShadowNode = std::shared_ptr<ScrollViewShadowNode>{};
+  auto childShadowNode = std::shared_ptr<ViewShadowNode>{};
+  // clang-format off
+  auto element =
+    Element<ScrollViewShadowNode>()
+      .reference(scrollViewShadowNode)
+      .finalize([](ScrollViewShadowNode &shadowNode){
+        auto layoutMetrics = EmptyLayoutMetrics;
+        layoutMetrics.frame.origin = {10, 20};
+        layoutMetrics.frame.size = {100, 200};
+        shadowNode.setLayoutMetrics(layoutMetrics);
+      })
+      .children({
+        Element<ViewShadowNode>()
+        .finalize([](ViewShadowNode &shadowNode){
+          auto layoutMetrics = EmptyLayoutMetrics;
+          layoutMetrics.frame.origin = {10, 20};
+          layoutMetrics.frame.size = {100, 200};
+          shadowNode.setLayoutMetrics(layoutMetrics);
+        })
+        .reference(childShadowNode)
+    });
+  // clang-format on
+
+  auto parentShadowNode = builder_.build(element);
+  auto state = scrollViewShadowNode->getState();
+
+  scrollViewShadowNode->getStateData().latestContentOffset->set({10, 10});
+
+  auto relativeLayoutMetrics =
+      LayoutableShadowNode::computeRelativeLayoutMetrics(
+          childShadowNode->getFamily(),
+          *parentShadowNode,
+          {/* includeTransform = */ true});
+
+  EXPECT_EQ(relativeLayoutMetrics.frame.origin.x, 0);
+  EXPECT_EQ(relativeLayoutMetrics.frame.origin.y, 10);
+
+  scrollViewShadowNode->getStateData().latestContentOffset->set({0, 100});
+
+  relativeLayoutMetrics = LayoutableShadowNode::computeRelativeLayoutMetrics(
+      childShadowNode->getFamily(),
+      *parentShadowNode,
+      {/* includeTransform = */ true});
+
+  EXPECT_EQ(relativeLayoutMetrics.frame.origin.x, 10);
+  EXPECT_EQ(relativeLayoutMetrics.frame.origin.y, -80);
+
+  // Nothing was committed.
+  EXPECT_EQ(scrollViewShadowNode->getState(), state);
+}
+
 /*
  * ┌────────────────────────┐
  * │<View>                  │
@@ -6,14 +6,18 @@
  */
 
 #include <benchmark/benchmark.h>
+#include <folly/Conv.h>
 #include <folly/dynamic.h>
 #include <folly/json.h>
 #include <react/renderer/components/view/ViewComponentDescriptor.h>
 #include <react/renderer/core/EventDispatcher.h>
 #include <react/renderer/core/RawProps.h>
 #include <react/utils/ContextContainer.h>
+#include <react/utils/CoreFeatures.h>
+#include <algorithm>
 #include <exception>
 #include <string>
+#include <vector>
 
 namespace facebook::react {
 
@@ -82,6 +86,41 @@ static void propParsingRegularRawPropsWithNoSourceProps(
 }
 BENCHMARK(propParsingRegularRawPropsWithNoSourceProps);
 
+static void propParsingIdenticallyStyledCells(benchmark::State& state) {
+  ContextContainer contextContainer{};
+  PropsParserContext parserContext{-1, contextContainer};
+  auto descriptor = ViewComponentDescriptor{
+      ComponentDescriptorParameters{eventDispatcher, contextContainer}};
+  auto cellCount = state.range(0);
+  auto uniqueCells = state.range(1) != 0;
+  CoreFeatures::cacheParsedProps = state.range(2) != 0;
+  auto cellPropsDynamic = std::vector<folly::dynamic>{};
+  for (auto i = 0; i < cellCount; i++) {
+    auto cellProps = propsDynamic;
+    if (uniqueCells) {
+      cellProps["nativeID"] = folly::to<std::string>("cell-", i);
+    }
+    cellPropsDynamic.push_back(std::move(cellProps));
+  }
+
+  for (auto _ : state) {
+    for (const auto& cellProps : cellPropsDynamic) {
+      descriptor.cloneProps(parserContext, nullptr, RawProps{cellProps});
+    }
+  }
+
+  auto stats = descriptor.getParsedPropsCacheStats();
+  state.counters["hitRate"] = static_cast<double>(stats.hits) /
+      static_cast<double>(std::max<size_t>(stats.hits + stats.misses, 1));
+  CoreFeatures::cacheParsedProps = false;
+}
+BENCHMARK(propParsingIdenticallyStyledCells)
+    ->ArgNames({"cells", "unique", "cache"})
+    ->Args({1000, 0, 0})
+    ->Args({1000, 0, 1})
+    ->Args({1000, 1, 0})
+    ->Args({1000, 1, 1});
+
 } // namespace facebook::react
 
 BENCHMARK_MAIN();
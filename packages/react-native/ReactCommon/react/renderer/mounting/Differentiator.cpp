@@ -10,7 +10,11 @@
 #include <react/debug/react_native_assert.h>
 #include <react/renderer/core/LayoutableShadowNode.h>
 #include <react/renderer/debug/SystraceSection.h>
+#include <react/utils/CoreFeatures.h>
 #include <algorithm>
+#include <limits>
+#include <unordered_map>
+#include <unordered_set>
 #include "ShadowView.h"
 
 #ifdef DEBUG_LOGS_DIFFER
@@ -269,6 +273,18 @@ static void sliceChildShadowNodeViewPairsRecursivelyV2(
   }
 }
 
+void ViewLayerCache::clear() {
+  rootShadowNode = nullptr;
+  previousLayers.clear();
+  currentLayers.clear();
+}
+
+/*
+ * The cache of the diff running on the current thread, if any. Slicing is
+ * reached from too many places in the differ to pass it around.
+ */
+static thread_local ViewLayerCache* threadLocalViewLayerCache = nullptr;
+
 ShadowViewNodePair::NonOwningList sliceChildShadowNodeViewPairsV2(
     const ShadowNode& shadowNode,
     ViewNodePairScope& scope,
@@ -283,6 +299,28 @@ ShadowViewNodePair::NonOwningList sliceChildShadowNodeViewPairsV2(
     return pairList;
   }
 
+  // A sealed node (and therefore its whole subtree) is immutable, so the
+  // layer computed for it while its revision was diffed as the new tree can
+  // be reused when the revision is diffed as the old tree. That is the last
+  // time the layer is needed, so it is taken out of the cache.
+  auto viewLayerCache =
+      shadowNode.getSealed() ? threadLocalViewLayerCache : nullptr;
+  if (viewLayerCache != nullptr) {
+    auto it = viewLayerCache->previousLayers.find(&shadowNode);
+    if (it != viewLayerCache->previousLayers.end()) {
+      auto layer = std::move(it->second);
+      viewLayerCache->previousLayers.erase(it);
+      if (layer.layoutOffset == layoutOffset) {
+        pairList.reserve(layer.pairs.size());
+        for (auto& pair : layer.pairs) {
+          scope.push_back(std::move(pair));
+          pairList.push_back(&scope.back());
+        }
+        return pairList;
+      }
+    }
+  }
+
   size_t startOfStaticIndex = 0;
   sliceChildShadowNodeViewPairsRecursivelyV2(
       pairList, startOfStaticIndex, scope, layoutOffset, shadowNode);
@@ -296,6 +334,18 @@ ShadowViewNodePair::NonOwningList sliceChildShadowNodeViewPairsV2(
     child->mountIndex = (child->isConcreteView ? mountIndex++ : -1);
   }
 
+  if (viewLayerCache != nullptr) {
+    // The differ mutates the pairs it works with, hence the cache keeps
+    // copies.
+    auto& layer = viewLayerCache->currentLayers[&shadowNode];
+    layer.layoutOffset = layoutOffset;
+    layer.pairs.clear();
+    layer.pairs.reserve(pairList.size());
+    for (auto child : pairList) {
+      layer.pairs.push_back(*child);
+    }
+  }
+
   return pairList;
 }
 
@@ -1036,6 +1086,257 @@ static void calculateShadowViewMutationsFlattener(
   }
 }
 
+/*
+ * Returns the indices of a longest strictly increasing subsequence of
+ * `values`, in increasing order.
+ */
+static std::vector<size_t> longestIncreasingSubsequence(
+    const std::vector<size_t>& values) {
+  constexpr auto kNone = std::numeric_limits<size_t>::max();
+
+  // `tails[k]` is the index of the smallest value ending an increasing
+  // subsequence of length `k + 1`.
+  auto tails = std::vector<size_t>{};
+  auto predecessors = std::vector<size_t>(values.size(), kNone);
+  for (size_t index = 0; index < values.size(); index++) {
+    auto it = std::lower_bound(
+        tails.begin(), tails.end(), values[index], [&](size_t tail, size_t v) {
+          return values[tail] < v;
+        });
+    if (it != tails.begin()) {
+      predecessors[index] = *(it - 1);
+    }
+    if (it == tails.end()) {
+      tails.push_back(index);
+    } else {
+      *it = index;
+    }
+  }
+
+  auto result = std::vector<size_t>(tails.size());
+  auto index = tails.empty() ? kNone : tails.back();
+  for (auto it = result.rbegin(); it != result.rend(); it++) {
+    *it = index;
+    index = predecessors[index];
+  }
+  return result;
+}
+
+/*
+ * A Fenwick tree over a fixed number of slots which counts the occupied
+ * slots preceding a given one in O(log n).
+ */
+class OccupiedSlots final {
+ public:
+  explicit OccupiedSlots(size_t size) : counts_(size + 1, 0) {}
+
+  void add(size_t slot, int delta) {
+    for (auto index = slot + 1; index < counts_.size();
+         index += lowestBit(index)) {
+      counts_[index] += delta;
+    }
+  }
+
+  size_t countBefore(size_t slot) const {
+    auto count = 0;
+    for (auto index = slot; index > 0; index -= lowestBit(index)) {
+      count += counts_[index];
+    }
+    return static_cast<size_t>(count);
+  }
+
+ private:
+  static size_t lowestBit(size_t index) {
+    return index & (~index + 1);
+  }
+
+  std::vector<int> counts_;
+};
+
+/*
+ * Replaces `Remove` + `Insert` pairs of children reordered within
+ * `parentShadowView` with `Move` mutations. Children forming a longest
+ * increasing subsequence (of old positions, in new order) stay in place and
+ * only the other ones are moved, which gives the minimal number of moves.
+ * Indices of the resulting `Insert` and `Move` mutations refer to the
+ * children of the parent at the moment each of them is applied; they are
+ * tracked in O(n log n) for the whole layer.
+ * Layers where children are reparented because of (un)flattening are left
+ * untouched.
+ */
+static void collapseReordersIntoMoves(
+    OrderedMutationInstructionContainer& mutationContainer,
+    const ShadowView& parentShadowView,
+    const ShadowViewNodePair::NonOwningList& oldChildPairs,
+    const ShadowViewNodePair::NonOwningList& newChildPairs) {
+  auto isChildOfParent = [&](const ShadowViewMutation& mutation) {
+    return mutation.parentShadowView.tag == parentShadowView.tag;
+  };
+  if (!std::all_of(
+          mutationContainer.removeMutations.begin(),
+          mutationContainer.removeMutations.end(),
+          isChildOfParent) ||
+      !std::all_of(
+          mutationContainer.insertMutations.begin(),
+          mutationContainer.insertMutations.end(),
+          isChildOfParent)) {
+    return;
+  }
+
+  auto oldTags = std::vector<Tag>{};
+  auto oldPositions = std::unordered_map<Tag, size_t>{};
+  for (const auto* pair : oldChildPairs) {
+    if (pair->isConcreteView) {
+      oldPositions[pair->shadowView.tag] = oldTags.size();
+      oldTags.push_back(pair->shadowView.tag);
+    }
+  }
+
+  auto newTags = std::vector<Tag>{};
+  auto newShadowViews = std::unordered_map<Tag, const ShadowView*>{};
+  for (const auto* pair : newChildPairs) {
+    if (pair->isConcreteView) {
+      newShadowViews[pair->shadowView.tag] = &pair->shadowView;
+      newTags.push_back(pair->shadowView.tag);
+    }
+  }
+
+  // Make sure that the mutations are plain removals, insertions and reorders
+  // of the children of this parent.
+  auto reorderedTags = std::unordered_set<Tag>{};
+  auto removedTags = std::unordered_set<Tag>{};
+  for (const auto& mutation : mutationContainer.removeMutations) {
+    if (mutation.type != ShadowViewMutation::Remove) {
+      continue;
+    }
+    auto tag = mutation.oldChildShadowView.tag;
+    if (oldPositions.find(tag) == oldPositions.end()) {
+      return;
+    }
+    if (newShadowViews.find(tag) != newShadowViews.end()) {
+      reorderedTags.insert(tag);
+    } else {
+      removedTags.insert(tag);
+    }
+  }
+  if (reorderedTags.empty()) {
+    return;
+  }
+
+  auto insertedTags = size_t{0};
+  for (const auto& mutation : mutationContainer.insertMutations) {
+    auto tag = mutation.newChildShadowView.tag;
+    if (newShadowViews.find(tag) == newShadowViews.end() ||
+        (oldPositions.find(tag) != oldPositions.end() &&
+         reorderedTags.find(tag) == reorderedTags.end())) {
+      return;
+    }
+    insertedTags++;
+  }
+
+  auto survivingCount = size_t{0};
+  for (auto tag : oldTags) {
+    if (newShadowViews.find(tag) != newShadowViews.end()) {
+      survivingCount++;
+    } else if (removedTags.find(tag) == removedTags.end()) {
+      return;
+    }
+  }
+  if (insertedTags != newTags.size() - survivingCount + reorderedTags.size()) {
+    return;
+  }
+
+  // Children which stay in place.
+  auto matchedTags = std::vector<Tag>{};
+  auto matchedOldPositions = std::vector<size_t>{};
+  for (auto tag : newTags) {
+    auto it = oldPositions.find(tag);
+    if (it != oldPositions.end()) {
+      matchedTags.push_back(tag);
+      matchedOldPositions.push_back(it->second);
+    }
+  }
+  auto stationaryTags = std::unordered_set<Tag>{};
+  for (auto index : longestIncreasingSubsequence(matchedOldPositions)) {
+    stationaryTags.insert(matchedTags[index]);
+  }
+
+  // Every other child ends up right after the closest stationary child which
+  // precedes it in the new order. `runLengths[p + 1]` counts the children
+  // placed after the stationary child at old position `p`, `runLengths[0]`
+  // the ones placed before all stationary children.
+  struct PlacedChild {
+    Tag tag;
+    size_t run;
+    size_t offset;
+  };
+  auto placedChildren = std::vector<PlacedChild>{};
+  auto runLengths = std::vector<size_t>(oldTags.size() + 1, 0);
+  auto run = size_t{0};
+  for (auto tag : newTags) {
+    if (stationaryTags.find(tag) != stationaryTags.end()) {
+      run = oldPositions[tag] + 1;
+    } else {
+      placedChildren.push_back({tag, run, runLengths[run]++});
+    }
+  }
+
+  // Children get slots ordered like the children of the parent at any moment
+  // of the replay: old positions interleaved with the runs. A child keeps the
+  // slot of its old position until it is moved into its run.
+  auto runStarts = std::vector<size_t>(runLengths.size(), 0);
+  for (size_t index = 1; index < runLengths.size(); index++) {
+    runStarts[index] = runStarts[index - 1] + runLengths[index - 1] + 1;
+  }
+  auto oldSlot = [&](size_t oldPosition) {
+    return runStarts[oldPosition + 1] - 1;
+  };
+  auto occupiedSlots = OccupiedSlots{runStarts.back() + runLengths.back()};
+  for (size_t oldPosition = 0; oldPosition < oldTags.size(); oldPosition++) {
+    if (removedTags.find(oldTags[oldPosition]) == removedTags.end()) {
+      occupiedSlots.add(oldSlot(oldPosition), 1);
+    }
+  }
+
+  auto insertMutations = ShadowViewMutation::List{};
+  insertMutations.reserve(placedChildren.size());
+  for (const auto& placedChild : placedChildren) {
+    auto fromIndex = -1;
+    auto oldPosition = oldPositions.find(placedChild.tag);
+    if (oldPosition != oldPositions.end()) {
+      auto slot = oldSlot(oldPosition->second);
+      fromIndex = static_cast<int>(occupiedSlots.countBefore(slot));
+      occupiedSlots.add(slot, -1);
+    }
+
+    auto slot = runStarts[placedChild.run] + placedChild.offset;
+    auto index = static_cast<int>(occupiedSlots.countBefore(slot));
+    occupiedSlots.add(slot, 1);
+
+    const auto& shadowView = *newShadowViews[placedChild.tag];
+    if (fromIndex == -1) {
+      insertMutations.push_back(ShadowViewMutation::InsertMutation(
+          parentShadowView, shadowView, index));
+    } else if (fromIndex != index) {
+      insertMutations.push_back(ShadowViewMutation::MoveMutation(
+          parentShadowView, shadowView, fromIndex, index));
+    }
+  }
+
+  auto& removeMutations = mutationContainer.removeMutations;
+  removeMutations.erase(
+      std::remove_if(
+          removeMutations.begin(),
+          removeMutations.end(),
+          [&](const ShadowViewMutation& mutation) {
+            return mutation.type == ShadowViewMutation::Remove &&
+                reorderedTags.find(mutation.oldChildShadowView.tag) !=
+                reorderedTags.end();
+          }),
+      removeMutations.end());
+  mutationContainer.insertMutations = std::move(insertMutations);
+}
+
 static void calculateShadowViewMutationsV2(
     ViewNodePairScope& scope,
     ShadowViewMutation::List& mutations,
@@ -1522,6 +1823,13 @@ static void calculateShadowViewMutationsV2(
     }
   }
 
+  if (ShadowViewMutation::PlatformSupportsMoveInstruction &&
+      !mutationContainer.removeMutations.empty() &&
+      !mutationContainer.insertMutations.empty()) {
+    collapseReordersIntoMoves(
+        mutationContainer, parentShadowView, oldChildPairs, newChildPairs);
+  }
+
   // All mutations in an optimal order:
   std::move(
       mutationContainer.destructiveDownwardMutations.begin(),
@@ -1612,15 +1920,61 @@ ShadowViewNodePair::OwningList sliceChildShadowNodeViewPairsForTesting(
   return pairList;
 }
 
+/*
+ * Makes the layers sliced by the diff which just finished available to the
+ * next one. Layers of nodes of the old tree are dropped: nothing keeps those
+ * nodes alive, and a node allocated later at the same address must not pick
+ * them up. So are the layers that this diff didn't reuse.
+ */
+static void keepLayersOfTree(
+    ViewLayerCache& viewLayerCache,
+    const ShadowNode& rootShadowNode) {
+  viewLayerCache.previousLayers.clear();
+  for (auto& [shadowNode, layer] : viewLayerCache.currentLayers) {
+    auto isNodeOfTree = shadowNode == &rootShadowNode;
+    if (!isNodeOfTree) {
+      auto ancestors = shadowNode->getFamily().getAncestors(rootShadowNode);
+      if (!ancestors.empty()) {
+        const auto& [parent, index] = ancestors.back();
+        isNodeOfTree = parent.get().getChildren().at(index).get() == shadowNode;
+      }
+    }
+    if (isNodeOfTree) {
+      viewLayerCache.previousLayers.emplace(shadowNode, std::move(layer));
+    }
+  }
+  viewLayerCache.currentLayers.clear();
+  viewLayerCache.rootShadowNode = &rootShadowNode;
+}
+
 ShadowViewMutation::List calculateShadowViewMutations(
     const ShadowNode& oldRootShadowNode,
-    const ShadowNode& newRootShadowNode) {
+    const ShadowNode& newRootShadowNode,
+    ViewLayerCache* viewLayerCache) {
   SystraceSection s("calculateShadowViewMutations");
 
   // Root shadow nodes must be belong the same family.
   react_native_assert(
       ShadowNode::sameFamily(oldRootShadowNode, newRootShadowNode));
 
+  if (!CoreFeatures::cacheFlattenedViewLayers) {
+    viewLayerCache = nullptr;
+  }
+  if (viewLayerCache != nullptr &&
+      viewLayerCache->rootShadowNode != &oldRootShadowNode) {
+    // The layers describe a different tree.
+    viewLayerCache->previousLayers.clear();
+  }
+
+  struct ViewLayerCacheScope {
+    explicit ViewLayerCacheScope(ViewLayerCache* viewLayerCache) {
+      threadLocalViewLayerCache = viewLayerCache;
+    }
+    ~ViewLayerCacheScope() {
+      threadLocalViewLayerCache = nullptr;
+    }
+  } viewLayerCacheScope(viewLayerCache);
+
   // See explanation of scope in Differentiator.h.
   ViewNodePairScope viewNodePairScope{};
   ViewNodePairScope innerViewNodePairScope{};
@@ -1643,6 +1997,10 @@ ShadowViewMutation::List calculateShadowViewMutations(
       sliceChildShadowNodeViewPairsV2(oldRootShadowNode, viewNodePairScope),
       sliceChildShadowNodeViewPairsV2(newRootShadowNode, viewNodePairScope));
 
+  if (viewLayerCache != nullptr) {
+    keepLayersOfTree(*viewLayerCache, newRootShadowNode);
+  }
+
   return mutations;
 }
 
@@ -11,6 +11,7 @@
 #include <react/renderer/debug/flags.h>
 #include <react/renderer/mounting/ShadowViewMutation.h>
 #include <deque>
+#include <unordered_map>
 
 namespace facebook::react {
 
@@ -39,14 +40,44 @@ enum class ReparentMode { Flatten, Unflatten };
  */
 using ViewNodePairScope = std::deque<ShadowViewNodePair>;
 
+/*
+ * Flattened view layers sliced while a revision is diffed as the new tree,
+ * kept for the next diff, which visits the same revision as the old tree.
+ * Only layers of nodes of the new tree are kept, and the ones the next diff
+ * doesn't reuse are released when it finishes, so a cache never holds more
+ * than the layers of one revision. Used only if
+ * `CoreFeatures::cacheFlattenedViewLayers` is enabled.
+ * The owner (e.g. the `MountingCoordinator` of a surface) must keep the last
+ * new tree alive until the next diff, and `clear` the cache if that diff
+ * starts from another tree. Not thread-safe.
+ */
+struct ViewLayerCache final {
+  struct Layer {
+    Point layoutOffset;
+    ShadowViewNodePair::OwningList pairs;
+  };
+
+  void clear();
+
+  /*
+   * To be used by the Differentiator only.
+   */
+  const ShadowNode* rootShadowNode{nullptr};
+  std::unordered_map<const ShadowNode*, Layer> previousLayers;
+  std::unordered_map<const ShadowNode*, Layer> currentLayers;
+};
+
 /*
  * Calculates a list of view mutations which describes how the old
  * `ShadowTree` can be transformed to the new one.
  * The list of mutations might be and might not be optimal.
+ * If `viewLayerCache` is given, layers sliced from the new tree are kept in
+ * it for the next diff, and layers kept by the previous diff are reused.
  */
 ShadowViewMutation::List calculateShadowViewMutations(
     const ShadowNode& oldRootShadowNode,
-    const ShadowNode& newRootShadowNode);
+    const ShadowNode& newRootShadowNode,
+    ViewLayerCache* viewLayerCache = nullptr);
 
 /**
  * Generates a list of `ShadowViewNodePair`s that represents a layer of a
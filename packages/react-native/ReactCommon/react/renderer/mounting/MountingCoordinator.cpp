@@ -13,13 +13,31 @@
 #endif
 
 #include <condition_variable>
+#include <iterator>
 
 #include <react/debug/react_native_assert.h>
 #include <react/renderer/debug/SystraceSection.h>
+#include <react/renderer/mounting/MutationChunking.h>
+#include <react/renderer/mounting/RevisionReclaimer.h>
 #include <react/renderer/mounting/ShadowViewMutation.h>
 
 namespace facebook::react {
 
+/*
+ * Telemetry of a transaction which doesn't correspond to a commit of its own:
+ * every phase is reported as instantaneous.
+ */
+static TransactionTelemetry instantaneousTelemetry() {
+  auto telemetry = TransactionTelemetry{};
+  telemetry.willLayout();
+  telemetry.didLayout();
+  telemetry.willCommit();
+  telemetry.didCommit();
+  telemetry.willDiff();
+  telemetry.didDiff();
+  return telemetry;
+}
+
 MountingCoordinator::MountingCoordinator(const ShadowTreeRevision& baseRevision)
     : surfaceId_(baseRevision.rootShadowNode->getSurfaceId()),
       baseRevision_(baseRevision),
@@ -41,35 +59,152 @@ void MountingCoordinator::push(ShadowTreeRevision revision) const {
     react_native_assert(
         !lastRevision_.has_value() || revision.number != lastRevision_->number);
 
+    auto retainedNodes = size_t{0};
     if (!lastRevision_.has_value() || lastRevision_->number < revision.number) {
+      if (tracksRetention_) {
+        // The revision is tracked against the one it replaces, which the
+        // coordinator still holds at this point.
+        const auto& previousRootShadowNode = lastRevision_.has_value()
+            ? lastRevision_->rootShadowNode
+            : baseRevision_.rootShadowNode;
+        auto stats = retentionTracker_.track(
+            revision.rootShadowNode, previousRootShadowNode);
+        retainedNodes = stats.retainedNodes;
+      }
+
+      if (lastRevision_.has_value()) {
+        // The revision was never mounted.
+        RevisionReclaimer::shared().retire(
+            std::move(lastRevision_->rootShadowNode));
+      }
       lastRevision_ = std::move(revision);
     }
+
+    // Diffing is left to `pullTransaction`, which runs on the mounting
+    // layer's thread and hands each diff to the override delegate as a
+    // single revision.
+    if (retainedNodesLimit_ != 0 && retainedNodes > retainedNodesLimit_) {
+      isOverRetainedNodesLimit_ = true;
+    }
   }
 
   signal_.notify_all();
 }
 
 void MountingCoordinator::revoke() const {
-  std::scoped_lock lock(mutex_);
-  // We have two goals here.
-  // 1. We need to stop retaining `ShadowNode`s to not prolong their lifetime
-  // to prevent them from overliving `ComponentDescriptor`s.
-  // 2. A possible call to `pullTransaction()` should return empty optional.
-  baseRevision_.rootShadowNode.reset();
+  {
+    std::scoped_lock lock(mutex_);
+    // We have two goals here.
+    // 1. We need to stop retaining `ShadowNode`s to not prolong their lifetime
+    // to prevent them from overliving `ComponentDescriptor`s.
+    // 2. A possible call to `pullTransaction()` should return empty optional.
+    baseRevision_.rootShadowNode.reset();
+    lastRevision_.reset();
+    viewLayerCache_.clear();
+    isOverRetainedNodesLimit_ = false;
+    pendingMutations_.clear();
+    pendingTelemetry_.reset();
+    chunkedMutations_.clear();
+    chunkEnds_.clear();
+    chunkedMutationsOffset_ = 0;
+    chunkedTelemetry_.reset();
+  }
+
+  // Revisions retired earlier must not outlive `ComponentDescriptor`s either.
+  // Revisions of other surfaces are left to the background thread.
+  RevisionReclaimer::shared().drain(surfaceId_);
+}
+
+void MountingCoordinator::diffLastRevision() const {
+  SystraceSection section("MountingCoordinator::diffLastRevision");
+
+  auto telemetry = lastRevision_->telemetry;
+
+  telemetry.willDiff();
+
+  auto mutations = calculateShadowViewMutations(
+      *baseRevision_.rootShadowNode,
+      *lastRevision_->rootShadowNode,
+      &viewLayerCache_);
+
+  telemetry.didDiff();
+
+  pendingMutations_.insert(
+      pendingMutations_.end(),
+      std::make_move_iterator(mutations.begin()),
+      std::make_move_iterator(mutations.end()));
+  pendingTelemetry_ = telemetry;
+
+  RevisionReclaimer::shared().retire(std::move(baseRevision_.rootShadowNode));
+  baseRevision_ = std::move(*lastRevision_);
   lastRevision_.reset();
 }
 
+void MountingCoordinator::enqueueChunkedMutations() const {
+  SystraceSection section("MountingCoordinator::enqueueChunkedMutations");
+
+  auto offset = chunkedMutations_.size();
+  auto chunkEnds = mutationsPerTransactionLimit_ != 0
+      ? prepareMutationsForChunking(
+            pendingMutations_, mutationsPerTransactionLimit_)
+      : std::vector<size_t>{pendingMutations_.size()};
+  if (chunkEnds.empty()) {
+    // Transactions without mutations are still delivered.
+    chunkEnds.push_back(0);
+  }
+  for (auto chunkEnd : chunkEnds) {
+    chunkEnds_.push_back(offset + chunkEnd);
+  }
+
+  chunkedMutations_.insert(
+      chunkedMutations_.end(),
+      std::make_move_iterator(pendingMutations_.begin()),
+      std::make_move_iterator(pendingMutations_.end()));
+  chunkedTelemetry_ = pendingTelemetry_;
+
+  pendingMutations_.clear();
+  pendingTelemetry_.reset();
+}
+
+ShadowViewMutation::List MountingCoordinator::dequeueChunkedMutations(
+    bool dequeueAll) const {
+  // Without a limit (it might have been lifted meanwhile), everything left
+  // goes into one transaction, as it does on request.
+  auto chunkEnd = mutationsPerTransactionLimit_ != 0 && !dequeueAll
+      ? chunkEnds_.front()
+      : chunkedMutations_.size();
+  while (!chunkEnds_.empty() && chunkEnds_.front() <= chunkEnd) {
+    chunkEnds_.pop_front();
+  }
+
+  auto mutations = ShadowViewMutation::List{
+      std::make_move_iterator(
+          chunkedMutations_.begin() + chunkedMutationsOffset_),
+      std::make_move_iterator(chunkedMutations_.begin() + chunkEnd)};
+  chunkedMutationsOffset_ = chunkEnd;
+
+  if (chunkEnds_.empty()) {
+    chunkedMutations_.clear();
+    chunkedMutationsOffset_ = 0;
+  }
+
+  return mutations;
+}
+
 bool MountingCoordinator::waitForTransaction(
     std::chrono::duration<double> timeout) const {
   std::unique_lock<std::mutex> lock(mutex_);
-  return signal_.wait_for(
-      lock, timeout, [this]() { return lastRevision_.has_value(); });
+  return signal_.wait_for(lock, timeout, [this]() {
+    return lastRevision_.has_value() || pendingTelemetry_.has_value() ||
+        chunkedTelemetry_.has_value();
+  });
 }
 
 void MountingCoordinator::updateBaseRevision(
     const ShadowTreeRevision& baseRevision) const {
   std::scoped_lock lock(mutex_);
   baseRevision_ = baseRevision;
+  viewLayerCache_.clear();
 }
 
 void MountingCoordinator::resetLatestRevision() const {
@@ -85,28 +220,62 @@ std::optional<MountingTransaction> MountingCoordinator::pullTransaction()
 
   auto transaction = std::optional<MountingTransaction>{};
 
+#ifdef RN_SHADOW_TREE_INTROSPECTION
+  auto oldRootShadowNode = baseRevision_.rootShadowNode;
+#endif
+
   // Base case
   if (lastRevision_.has_value()) {
-    number_++;
+    if (isOverRetainedNodesLimit_) {
+      forcedDiffCount_++;
+    }
+    diffLastRevision();
+  }
+  isOverRetainedNodesLimit_ = false;
 
-    auto telemetry = lastRevision_->telemetry;
+  auto mountingOverrideDelegate = mountingOverrideDelegate_.lock();
+  auto shouldOverridePullTransaction = mountingOverrideDelegate &&
+      mountingOverrideDelegate->shouldOverridePullTransaction();
 
-    telemetry.willDiff();
+  // The delegate (e.g. LayoutAnimations) expects every transaction to bring
+  // the tree to a complete revision, so nothing is chunked while it overrides
+  // transactions and chunks which are still queued are flushed at once.
+  if (pendingTelemetry_.has_value() &&
+      ((mutationsPerTransactionLimit_ != 0 && !shouldOverridePullTransaction) ||
+       chunkedTelemetry_.has_value())) {
+    // New mutations must be mounted after the chunks that are still queued.
+    enqueueChunkedMutations();
+  }
 
-    auto mutations = calculateShadowViewMutations(
-        *baseRevision_.rootShadowNode, *lastRevision_->rootShadowNode);
+  if (chunkedTelemetry_.has_value()) {
+    number_++;
 
-    telemetry.didDiff();
+    transaction = MountingTransaction{
+        surfaceId_,
+        number_,
+        dequeueChunkedMutations(shouldOverridePullTransaction),
+        *chunkedTelemetry_};
+
+    if (chunkEnds_.empty()) {
+      chunkedTelemetry_.reset();
+    } else {
+      // Only the first chunk reports the layout, commit and diff of the
+      // revision; the following ones only add their own mounting time.
+      auto revisionNumber = chunkedTelemetry_->getRevisionNumber();
+      chunkedTelemetry_ = instantaneousTelemetry();
+      chunkedTelemetry_->setRevisionNumber(revisionNumber);
+    }
+  } else if (pendingTelemetry_.has_value()) {
+    number_++;
 
     transaction = MountingTransaction{
-        surfaceId_, number_, std::move(mutations), telemetry};
+        surfaceId_, number_, std::move(pendingMutations_), *pendingTelemetry_};
+
+    pendingMutations_.clear();
+    pendingTelemetry_.reset();
   }
 
   // Override case
-  auto mountingOverrideDelegate = mountingOverrideDelegate_.lock();
-  auto shouldOverridePullTransaction = mountingOverrideDelegate &&
-      mountingOverrideDelegate->shouldOverridePullTransaction();
-
   if (shouldOverridePullTransaction) {
     SystraceSection section2("MountingCoordinator::overridePullTransaction");
 
@@ -114,16 +283,12 @@ std::optional<MountingTransaction> MountingCoordinator::pullTransaction()
     auto telemetry = TransactionTelemetry{};
 
     if (transaction.has_value()) {
-      mutations = transaction->getMutations();
+      // Delegates (e.g. LayoutAnimations) don't handle `Move` mutations.
+      mutations = expandMoveMutations(transaction->getMutations());
       telemetry = transaction->getTelemetry();
     } else {
       number_++;
-      telemetry.willLayout();
-      telemetry.didLayout();
-      telemetry.willCommit();
-      telemetry.didCommit();
-      telemetry.willDiff();
-      telemetry.didDiff();
+      telemetry = instantaneousTelemetry();
     }
 
     transaction = mountingOverrideDelegate->pullTransaction(
@@ -144,18 +309,17 @@ std::optional<MountingTransaction> MountingCoordinator::pullTransaction()
 
     // If the transaction was overridden, we don't have a model of the shadow
     // tree therefore we cannot validate the validity of the mutation
-    // instructions.
-    if (!shouldOverridePullTransaction && lastRevision_.has_value()) {
+    // instructions. The same applies until all chunks are pulled.
+    if (!shouldOverridePullTransaction && !chunkedTelemetry_.has_value()) {
       auto stubViewTree = buildStubViewTreeWithoutUsingDifferentiator(
-          *lastRevision_->rootShadowNode);
+          *baseRevision_.rootShadowNode);
 
       bool treesEqual = stubViewTree_ == stubViewTree;
 
       if (!treesEqual) {
         // Display debug info
         auto line = std::string{};
-        std::stringstream ssOldTree(
-            baseRevision_.rootShadowNode->getDebugDescription());
+        std::stringstream ssOldTree(oldRootShadowNode->getDebugDescription());
         while (std::getline(ssOldTree, line, '\n')) {
           LOG(ERROR) << "Old tree:" << line;
         }
@@ -166,7 +330,7 @@ std::optional<MountingTransaction> MountingCoordinator::pullTransaction()
         }
 
         std::stringstream ssNewTree(
-            lastRevision_->rootShadowNode->getDebugDescription());
+            baseRevision_.rootShadowNode->getDebugDescription());
         while (std::getline(ssNewTree, line, '\n')) {
           LOG(ERROR) << "New tree:" << line;
         }
@@ -178,22 +342,74 @@ std::optional<MountingTransaction> MountingCoordinator::pullTransaction()
   }
 #endif
 
-  if (lastRevision_.has_value()) {
-    baseRevision_ = std::move(*lastRevision_);
-    lastRevision_.reset();
-  }
   return transaction;
 }
 
 bool MountingCoordinator::hasPendingTransactions() const {
   std::scoped_lock lock(mutex_);
-  return lastRevision_.has_value();
+  return lastRevision_.has_value() || pendingTelemetry_.has_value() ||
+      chunkedTelemetry_.has_value();
 }
 
 const TelemetryController& MountingCoordinator::getTelemetryController() const {
   return telemetryController_;
 }
 
+RevisionRetentionTracker::Stats MountingCoordinator::getRetentionStats()
+    const {
+  return retentionTracker_.getStats();
+}
+
+void MountingCoordinator::setRetentionTrackingEnabled(bool enabled) const {
+  std::scoped_lock lock(mutex_);
+  retentionTrackingEnabled_ = enabled;
+  updateRetentionTracking();
+}
+
+void MountingCoordinator::setRetainedNodesLimit(size_t limit) const {
+  std::scoped_lock lock(mutex_);
+  retainedNodesLimit_ = limit;
+  updateRetentionTracking();
+}
+
+void MountingCoordinator::updateRetentionTracking() const {
+  auto tracksRetention = retentionTrackingEnabled_ || retainedNodesLimit_ != 0;
+  if (tracksRetention == tracksRetention_) {
+    return;
+  }
+
+  tracksRetention_ = tracksRetention;
+  retentionTracker_.reset();
+  if (!tracksRetention_) {
+    return;
+  }
+
+  // Revisions the coordinator holds on to are accounted for from now on.
+  if (baseRevision_.rootShadowNode) {
+    retentionTracker_.track(baseRevision_.rootShadowNode, nullptr);
+  }
+  if (lastRevision_.has_value()) {
+    retentionTracker_.track(
+        lastRevision_->rootShadowNode, baseRevision_.rootShadowNode);
+  }
+}
+
+size_t MountingCoordinator::getForcedDiffCount() const {
+  std::scoped_lock lock(mutex_);
+  return forcedDiffCount_;
+}
+
+void MountingCoordinator::setMutationsPerTransactionLimit(size_t limit) const {
+  std::scoped_lock lock(mutex_);
+  mutationsPerTransactionLimit_ = limit;
+}
+
+MountingCoordinator::ChunkingProgress
+MountingCoordinator::getChunkingProgress() const {
+  std::scoped_lock lock(mutex_);
+  return {chunkedMutationsOffset_, chunkedMutations_.size()};
+}
+
 ShadowTreeRevision MountingCoordinator::getBaseRevision() const {
   std::scoped_lock lock(mutex_);
   return baseRevision_;
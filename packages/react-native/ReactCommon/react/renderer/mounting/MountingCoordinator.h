@@ -9,12 +9,14 @@
 
 #include <chrono>
 #include <condition_variable>
+#include <deque>
 #include <optional>
 
 #include <react/renderer/debug/flags.h>
 #include <react/renderer/mounting/Differentiator.h>
 #include <react/renderer/mounting/MountingOverrideDelegate.h>
 #include <react/renderer/mounting/MountingTransaction.h>
+#include <react/renderer/mounting/RevisionRetentionTracker.h>
 #include <react/renderer/mounting/ShadowTreeRevision.h>
 #include <react/renderer/mounting/TelemetryController.h>
 #include "ShadowTreeRevision.h"
@@ -62,7 +64,8 @@ class MountingCoordinator final {
    * Indicates if there are transactions waiting to be consumed and mounted on
    * the host platform. This can be useful to determine if side-effects of
    * mounting can be expected after some operations (like IntersectionObserver
-   * initial paint notifications).
+   * initial paint notifications). This includes chunks of mutations which were
+   * not pulled yet (see `setMutationsPerTransactionLimit`).
    */
   bool hasPendingTransactions() const;
 
@@ -79,6 +82,67 @@ class MountingCoordinator final {
 
   const TelemetryController& getTelemetryController() const;
 
+  /*
+   * Returns accounting of the revisions of the surface that are still alive
+   * and the shadow nodes they retain. Revisions are only accounted for while
+   * retention tracking is enabled or a retained nodes limit is set; otherwise
+   * the stats are empty.
+   */
+  RevisionRetentionTracker::Stats getRetentionStats() const;
+
+  /*
+   * Enables accounting of retained revisions for `getRetentionStats`. Tracking
+   * visits the changed parts of every pushed revision, so it is off by default.
+   */
+  void setRetentionTrackingEnabled(bool enabled) const;
+
+  /*
+   * Sets the number of retained shadow nodes above which a pushed revision
+   * marks the coordinator as over the limit. Pushing never diffs: the
+   * committing thread must not spend time on it, and the override delegate
+   * has to receive every diff as a single revision. The next
+   * `pullTransaction` diffs the revision as usual, on the mounting layer's
+   * thread, and counts it in `getForcedDiffCount`. Zero (the default) means
+   * no limit. A limit enables retention tracking.
+   */
+  void setRetainedNodesLimit(size_t limit) const;
+
+  /*
+   * Returns the number of pulled transactions which diffed a revision pushed
+   * while over the retained nodes limit.
+   */
+  size_t getForcedDiffCount() const;
+
+  /*
+   * Sets the maximum number of mutations in a transaction returned by
+   * `pullTransaction`. Bigger sets of mutations are split into several
+   * consecutive transactions (see `prepareMutationsForChunking`), which the
+   * mounting layer can apply across several frames. Newly created subtrees are
+   * mounted in document order and appear fully built unless they exceed the
+   * limit on their own. Zero (the default) means no limit.
+   *
+   * A mounting layer which sets a limit takes on the pull contract: it is
+   * notified about new transactions once per commit, not once per chunk, so
+   * it has to keep calling `pullTransaction` (e.g. once per frame) while
+   * `hasPendingTransactions` returns `true`. Until then, the host tree only
+   * reflects the chunks pulled so far.
+   * Only the first chunk of a revision carries its layout, commit and diff
+   * telemetry. Nothing is chunked while a `MountingOverrideDelegate`
+   * overrides transactions.
+   */
+  void setMutationsPerTransactionLimit(size_t limit) const;
+
+  /*
+   * Progress of mounting of chunked mutations: how many of the mutations
+   * queued since the mounting layer last caught up were pulled already.
+   */
+  struct ChunkingProgress {
+    size_t pulledMutations{0};
+    size_t totalMutations{0};
+  };
+
+  ChunkingProgress getChunkingProgress() const;
+
   ShadowTreeRevision getBaseRevision() const;
 
   /*
@@ -109,20 +173,69 @@ class MountingCoordinator final {
    */
   void revoke() const;
 
+  /*
+   * Diffs `lastRevision_` against `baseRevision_`, accumulates the mutations
+   * and makes `lastRevision_` the new base revision. Must be called with
+   * `mutex_` held.
+   */
+  void diffLastRevision() const;
+
+  /*
+   * Starts or stops tracking retained revisions so that it happens only while
+   * tracking is enabled or a retained nodes limit is set.
+   * Must be called with `mutex_` held.
+   */
+  void updateRetentionTracking() const;
+
+  /*
+   * Moves `pendingMutations_` to the queue of chunked mutations.
+   * Must be called with `mutex_` held.
+   */
+  void enqueueChunkedMutations() const;
+
+  /*
+   * Removes and returns the next chunk of chunked mutations, or all of them
+   * if `dequeueAll` is set.
+   * Must be called with `mutex_` held.
+   */
+  ShadowViewMutation::List dequeueChunkedMutations(bool dequeueAll) const;
+
  private:
   const SurfaceId surfaceId_;
 
-  // Protects access to `baseRevision_`, `lastRevision_` and
-  // `mountingOverrideDelegate_`.
+  // Protects access to `baseRevision_`, `lastRevision_`, `viewLayerCache_`,
+  // `pendingMutations_`, `pendingTelemetry_`, `retainedNodesLimit_`,
+  // `isOverRetainedNodesLimit_`, `forcedDiffCount_`, the retention tracking
+  // flags, the chunking state and `mountingOverrideDelegate_`.
   mutable std::mutex mutex_;
   mutable ShadowTreeRevision baseRevision_;
   mutable std::optional<ShadowTreeRevision> lastRevision_{};
+  // Layers of `baseRevision_` sliced when it was diffed as the new tree.
+  mutable ViewLayerCache viewLayerCache_{};
+  // Mutations of the revision diffed by `pullTransaction` which are not
+  // handed out yet.
+  mutable ShadowViewMutation::List pendingMutations_{};
+  // Telemetry of the revision in `pendingMutations_`.
+  mutable std::optional<TransactionTelemetry> pendingTelemetry_{};
+  mutable size_t retainedNodesLimit_{0};
+  mutable bool isOverRetainedNodesLimit_{false};
+  mutable bool retentionTrackingEnabled_{false};
+  mutable bool tracksRetention_{false};
+  mutable size_t forcedDiffCount_{0};
+  mutable size_t mutationsPerTransactionLimit_{0};
+  // Mutations which are handed out in chunks; the ones before
+  // `chunkedMutationsOffset_` were pulled already.
+  mutable ShadowViewMutation::List chunkedMutations_{};
+  mutable std::deque<size_t> chunkEnds_{};
+  mutable size_t chunkedMutationsOffset_{0};
+  mutable std::optional<TransactionTelemetry> chunkedTelemetry_{};
   mutable MountingTransaction::Number number_{0};
   mutable std::condition_variable signal_;
   mutable std::weak_ptr<const MountingOverrideDelegate>
       mountingOverrideDelegate_;
 
   TelemetryController telemetryController_;
+  mutable RevisionRetentionTracker retentionTracker_;
 
 #ifdef RN_SHADOW_TREE_INTROSPECTION
   mutable StubViewTree stubViewTree_; // Protected by `mutex_`.
@@ -30,6 +30,9 @@ class MountingOverrideDelegate {
    * - Calling
    * - Telemetry, if appropriate
    *
+   * `mutations` never contain `Move` mutations; reordered children are
+   * described with `Remove` + `Insert` pairs.
+   *
    * @param surfaceId
    * @param number
    * @param mountingCoordinator
@@ -0,0 +1,217 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "MutationChunking.h"
+
+#include <unordered_map>
+
+#include <react/debug/react_native_assert.h>
+
+namespace facebook::react {
+
+namespace {
+
+/*
+ * What the list of mutations does to a particular view.
+ */
+struct ViewRecord {
+  int createIndex{-1};
+  int insertIndex{-1};
+  ViewRecord* parent{nullptr};
+
+  // The view is deleted, removed, updated, moved or created/inserted more
+  // than once, so its mutations must stay in place.
+  bool isTouched{false};
+
+  // `Insert` mutations which have the view as the parent.
+  struct Child {
+    int insertIndex;
+    ViewRecord* record;
+  };
+  std::vector<Child> children{};
+
+  // Whether the view and all views inserted into it form a new subtree.
+  // Computed lazily.
+  enum class Status { Unknown, New, Existing } status{Status::Unknown};
+  size_t subtreeSize{0};
+};
+
+class MutationChunker final {
+ public:
+  MutationChunker(ShadowViewMutation::List& mutations, size_t maxChunkSize)
+      : mutations_(mutations), maxChunkSize_(maxChunkSize) {}
+
+  std::vector<size_t> prepare() {
+    collectRecords();
+
+    // Mutations of new subtrees are moved to the insertion of the root of
+    // the subtree; everything else stays in order.
+    auto isMoved = std::vector<bool>(mutations_.size(), false);
+    auto subtreeRoots =
+        std::vector<const ViewRecord*>(mutations_.size(), nullptr);
+    for (auto& [tag, viewRecord] : records_) {
+      if (isNewSubtree(viewRecord)) {
+        isMoved[viewRecord.createIndex] = true;
+        isMoved[viewRecord.insertIndex] = true;
+        if (!isNewSubtree(*viewRecord.parent)) {
+          subtreeRoots[viewRecord.insertIndex] = &viewRecord;
+        }
+      }
+    }
+
+    reordered_.reserve(mutations_.size());
+    for (size_t index = 0; index < mutations_.size(); index++) {
+      if (subtreeRoots[index] != nullptr) {
+        appendSubtree(*subtreeRoots[index]);
+      } else if (!isMoved[index]) {
+        appendUnit({static_cast<int>(index)});
+      }
+    }
+
+    closeChunk();
+    react_native_assert(reordered_.size() == mutations_.size());
+    mutations_ = std::move(reordered_);
+    return std::move(chunkEnds_);
+  }
+
+ private:
+  ViewRecord& record(Tag tag) {
+    return records_[tag];
+  }
+
+  void collectRecords() {
+    records_.reserve(mutations_.size());
+    for (size_t index = 0; index < mutations_.size(); index++) {
+      const auto& mutation = mutations_[index];
+      switch (mutation.type) {
+        case ShadowViewMutation::Create: {
+          auto& childRecord = record(mutation.newChildShadowView.tag);
+          childRecord.isTouched |= childRecord.createIndex != -1;
+          childRecord.createIndex = static_cast<int>(index);
+          break;
+        }
+        case ShadowViewMutation::Insert: {
+          auto& childRecord = record(mutation.newChildShadowView.tag);
+          childRecord.isTouched |= childRecord.insertIndex != -1 ||
+              childRecord.createIndex == -1;
+          childRecord.insertIndex = static_cast<int>(index);
+          childRecord.parent = &record(mutation.parentShadowView.tag);
+          childRecord.parent->children.push_back(
+              {static_cast<int>(index), &childRecord});
+          break;
+        }
+        case ShadowViewMutation::Remove:
+        case ShadowViewMutation::Move:
+          record(mutation.parentShadowView.tag).isTouched = true;
+          record(mutation.oldChildShadowView.tag).isTouched = true;
+          record(mutation.newChildShadowView.tag).isTouched = true;
+          break;
+        default:
+          record(mutation.oldChildShadowView.tag).isTouched = true;
+          record(mutation.newChildShadowView.tag).isTouched = true;
+          break;
+      }
+    }
+  }
+
+  /*
+   * A view starts a new subtree if the list only creates it, inserts it and
+   * inserts other new subtrees into it.
+   */
+  bool isNewSubtree(ViewRecord& viewRecord) {
+    if (viewRecord.status != ViewRecord::Status::Unknown) {
+      return viewRecord.status == ViewRecord::Status::New;
+    }
+
+    viewRecord.status = ViewRecord::Status::Existing;
+    if (viewRecord.isTouched || viewRecord.createIndex == -1 ||
+        viewRecord.insertIndex == -1) {
+      return false;
+    }
+
+    size_t subtreeSize = 1;
+    for (const auto& child : viewRecord.children) {
+      if (!isNewSubtree(*child.record)) {
+        return false;
+      }
+      subtreeSize += child.record->subtreeSize;
+    }
+
+    viewRecord.status = ViewRecord::Status::New;
+    viewRecord.subtreeSize = subtreeSize;
+    return true;
+  }
+
+  /*
+   * Appends the mutations of a new subtree, finishing with the insertion of
+   * its root.
+   */
+  void appendSubtree(const ViewRecord& viewRecord) {
+    // Every view of the subtree needs a `Create` and an `Insert`.
+    if (viewRecord.subtreeSize * 2 <= maxChunkSize_) {
+      auto indices = std::vector<int>{};
+      indices.reserve(viewRecord.subtreeSize * 2);
+      collectSubtree(viewRecord, indices);
+      indices.push_back(viewRecord.insertIndex);
+      appendUnit(indices);
+      return;
+    }
+
+    // Too big for a single chunk: the root is attached first, so that the
+    // subtrees inserted into it can appear one by one.
+    appendUnit({viewRecord.createIndex, viewRecord.insertIndex});
+    for (const auto& child : viewRecord.children) {
+      appendSubtree(*child.record);
+    }
+  }
+
+  void collectSubtree(const ViewRecord& viewRecord, std::vector<int>& indices) {
+    indices.push_back(viewRecord.createIndex);
+    for (const auto& child : viewRecord.children) {
+      collectSubtree(*child.record, indices);
+      indices.push_back(child.insertIndex);
+    }
+  }
+
+  /*
+   * Appends mutations which must not be split between chunks.
+   */
+  void appendUnit(const std::vector<int>& indices) {
+    auto chunkSize = reordered_.size() - chunkStart_;
+    if (chunkSize != 0 && chunkSize + indices.size() > maxChunkSize_) {
+      closeChunk();
+    }
+    for (auto index : indices) {
+      reordered_.push_back(std::move(mutations_[index]));
+    }
+  }
+
+  void closeChunk() {
+    if (reordered_.size() != chunkStart_) {
+      chunkStart_ = reordered_.size();
+      chunkEnds_.push_back(chunkStart_);
+    }
+  }
+
+  ShadowViewMutation::List& mutations_;
+  size_t maxChunkSize_;
+
+  std::unordered_map<Tag, ViewRecord> records_{};
+  ShadowViewMutation::List reordered_{};
+  std::vector<size_t> chunkEnds_{};
+  size_t chunkStart_{0};
+};
+
+} // namespace
+
+std::vector<size_t> prepareMutationsForChunking(
+    ShadowViewMutation::List& mutations,
+    size_t maxChunkSize) {
+  return MutationChunker{mutations, maxChunkSize}.prepare();
+}
+
+} // namespace facebook::react
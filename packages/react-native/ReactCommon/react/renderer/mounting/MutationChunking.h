@@ -0,0 +1,35 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <vector>
+
+#include <react/renderer/mounting/ShadowViewMutation.h>
+
+namespace facebook::react {
+
+/*
+ * Prepares a list of mutations for being mounted in several chunks (e.g.
+ * across several frames) and returns the end offsets of those chunks.
+ *
+ * Views which are created and inserted by the list without being touched
+ * otherwise form new subtrees. The mutations of every such subtree are
+ * moved next to the insertion of its root and emitted in document order, so
+ * that a chunk boundary never leaves a created view detached. A new subtree
+ * which needs at most `maxChunkSize` mutations appears in a single chunk;
+ * bigger ones are attached container-first and filled in by subsequent
+ * chunks. Any other mutation keeps its position and can end a chunk.
+ *
+ * Applying the chunks in order is equivalent to applying the original list,
+ * and every prefix of chunks produces a valid view hierarchy.
+ */
+std::vector<size_t> prepareMutationsForChunking(
+    ShadowViewMutation::List& mutations,
+    size_t maxChunkSize);
+
+} // namespace facebook::react
@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "RevisionReclaimer.h"
+
+#include <algorithm>
+#include <iterator>
+
+#if defined(__APPLE__)
+#include <pthread.h>
+#include <sys/qos.h>
+#elif defined(__ANDROID__) || defined(__linux__)
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include <react/renderer/debug/SystraceSection.h>
+#include <react/utils/CoreFeatures.h>
+
+namespace facebook::react {
+
+namespace {
+
+void lowerCurrentThreadPriority() {
+#if defined(__APPLE__)
+  pthread_set_qos_class_self_np(QOS_CLASS_UTILITY, 0);
+#elif defined(__ANDROID__) || defined(__linux__)
+  // The nice value is a per-thread attribute on Linux.
+  setpriority(PRIO_PROCESS, static_cast<id_t>(syscall(SYS_gettid)), 10);
+#endif
+}
+
+} // namespace
+
+RevisionReclaimer& RevisionReclaimer::shared() {
+  // Intentionally leaked: the background thread must not be joined while
+  // static destructors run.
+  static auto* reclaimer = new RevisionReclaimer();
+  return *reclaimer;
+}
+
+RevisionReclaimer::RevisionReclaimer(size_t maxPendingRevisions)
+    : maxPendingRevisions_(maxPendingRevisions) {}
+
+RevisionReclaimer::~RevisionReclaimer() {
+  {
+    std::scoped_lock lock(mutex_);
+    isStopped_ = true;
+  }
+  signal_.notify_all();
+
+  if (thread_.joinable()) {
+    thread_.join();
+  }
+  drain();
+}
+
+void RevisionReclaimer::retire(RootShadowNode::Shared rootShadowNode) {
+  if (!CoreFeatures::enableDeferredRevisionDestruction || !rootShadowNode ||
+      rootShadowNode.use_count() != 1) {
+    return;
+  }
+
+  {
+    std::scoped_lock lock(mutex_);
+    if (isStopped_ || pendingRevisions_.size() >= maxPendingRevisions_) {
+      stats_.synchronousRevisions++;
+    } else {
+      if (!thread_.joinable()) {
+        thread_ = std::thread([this] { run(); });
+      }
+      pendingRevisions_.push_back(std::move(rootShadowNode));
+      stats_.peakPendingRevisions =
+          std::max(stats_.peakPendingRevisions, pendingRevisions_.size());
+    }
+  }
+
+  if (rootShadowNode) {
+    // The backlog is full: the tree is destroyed right here, as it would be
+    // without the reclaimer.
+    rootShadowNode.reset();
+    return;
+  }
+
+  signal_.notify_all();
+}
+
+void RevisionReclaimer::drain() {
+  auto revisions = std::deque<RootShadowNode::Shared>{};
+  {
+    std::unique_lock lock(mutex_);
+    revisions.swap(pendingRevisions_);
+    signal_.wait(lock, [this] { return !destroyingSurfaceId_.has_value(); });
+  }
+  revisions.clear();
+}
+
+void RevisionReclaimer::drain(SurfaceId surfaceId) {
+  auto revisions = std::deque<RootShadowNode::Shared>{};
+  {
+    std::unique_lock lock(mutex_);
+    auto end = std::stable_partition(
+        pendingRevisions_.begin(),
+        pendingRevisions_.end(),
+        [&](const RootShadowNode::Shared& rootShadowNode) {
+          return rootShadowNode->getSurfaceId() != surfaceId;
+        });
+    revisions.insert(
+        revisions.end(),
+        std::make_move_iterator(end),
+        std::make_move_iterator(pendingRevisions_.end()));
+    pendingRevisions_.erase(end, pendingRevisions_.end());
+    signal_.wait(lock, [&] { return destroyingSurfaceId_ != surfaceId; });
+  }
+  revisions.clear();
+}
+
+RevisionReclaimer::Stats RevisionReclaimer::getStats() const {
+  std::scoped_lock lock(mutex_);
+  auto stats = stats_;
+  stats.pendingRevisions = pendingRevisions_.size();
+  return stats;
+}
+
+void RevisionReclaimer::run() {
+  lowerCurrentThreadPriority();
+
+  std::unique_lock lock(mutex_);
+  while (true) {
+    signal_.wait(
+        lock, [this] { return isStopped_ || !pendingRevisions_.empty(); });
+    if (pendingRevisions_.empty()) {
+      return;
+    }
+
+    auto rootShadowNode = std::move(pendingRevisions_.front());
+    pendingRevisions_.pop_front();
+    destroyingSurfaceId_ = rootShadowNode->getSurfaceId();
+    lock.unlock();
+
+    auto start = std::chrono::steady_clock::now();
+    {
+      SystraceSection section("RevisionReclaimer::destroy");
+      rootShadowNode.reset();
+    }
+    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - start);
+
+    lock.lock();
+    destroyingSurfaceId_.reset();
+    stats_.deferredRevisions++;
+    stats_.totalDestructionTime += duration;
+    stats_.longestDestruction = std::max(stats_.longestDestruction, duration);
+    signal_.notify_all();
+  }
+}
+
+} // namespace facebook::react
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <thread>
+
+#include <react/renderer/components/root/RootShadowNode.h>
+
+namespace facebook::react {
+
+/*
+ * Destroys retired shadow tree revisions on a low-priority background thread.
+ * Releasing the last reference to a root shadow node tears down the whole
+ * tree (nodes, props, states, Yoga nodes), which can take milliseconds on the
+ * thread that happens to drop it (e.g. the main thread pulling a transaction).
+ * Disabled unless `CoreFeatures::enableDeferredRevisionDestruction` is set.
+ * The class is thread-safe.
+ */
+class RevisionReclaimer final {
+ public:
+  struct Stats {
+    /*
+     * Number of revisions destroyed on the background thread.
+     */
+    size_t deferredRevisions{0};
+
+    /*
+     * Number of revisions destroyed by the retiring thread because the
+     * backlog was full.
+     */
+    size_t synchronousRevisions{0};
+
+    /*
+     * Number of revisions waiting to be destroyed, and its highest value
+     * observed so far.
+     */
+    size_t pendingRevisions{0};
+    size_t peakPendingRevisions{0};
+
+    /*
+     * Time spent destroying revisions on the background thread.
+     */
+    std::chrono::nanoseconds totalDestructionTime{0};
+    std::chrono::nanoseconds longestDestruction{0};
+  };
+
+  /*
+   * Process-wide instance.
+   */
+  static RevisionReclaimer& shared();
+
+  explicit RevisionReclaimer(size_t maxPendingRevisions = 32);
+  ~RevisionReclaimer();
+
+  /*
+   * Takes a reference to the root shadow node of a revision that is not
+   * needed anymore. If it is the last one, the tree is destroyed on the
+   * background thread, otherwise the reference is simply released.
+   */
+  void retire(RootShadowNode::Shared rootShadowNode);
+
+  /*
+   * Destroys all pending revisions and waits for the one being destroyed
+   * on the background thread, if any. Must be called before the
+   * `ComponentDescriptor`s of retired revisions go away.
+   */
+  void drain();
+
+  /*
+   * Same as `drain()`, but only for revisions of the given surface, so that
+   * stopping one surface doesn't tear down revisions of the others.
+   */
+  void drain(SurfaceId surfaceId);
+
+  Stats getStats() const;
+
+ private:
+  void run();
+
+  const size_t maxPendingRevisions_;
+
+  mutable std::mutex mutex_;
+  std::condition_variable signal_;
+  std::deque<RootShadowNode::Shared> pendingRevisions_;
+  // Surface of the revision being destroyed on the background thread.
+  std::optional<SurfaceId> destroyingSurfaceId_;
+  bool isStopped_{false};
+  std::thread thread_;
+  Stats stats_;
+};
+
+} // namespace facebook::react
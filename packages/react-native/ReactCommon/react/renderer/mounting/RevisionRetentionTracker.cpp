@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "RevisionRetentionTracker.h"
+
+#include <algorithm>
+
+namespace facebook::react {
+
+namespace {
+
+size_t countNodes(const ShadowNode& shadowNode) {
+  size_t count = 1;
+  for (const auto& childNode : shadowNode.getChildren()) {
+    count += countNodes(*childNode);
+  }
+  return count;
+}
+
+/*
+ * Counts nodes of `newNode`'s subtree which are not shared with `oldNode`'s.
+ * Children are paired by index, and a subtree that is pointer-equal to its
+ * counterpart is shared as a whole, so only the changed paths are visited.
+ */
+size_t countAddedNodes(const ShadowNode& oldNode, const ShadowNode& newNode) {
+  if (&oldNode == &newNode) {
+    return 0;
+  }
+
+  size_t count = 1;
+  const auto& oldChildren = oldNode.getChildren();
+  const auto& newChildren = newNode.getChildren();
+  for (size_t index = 0; index < newChildren.size(); index++) {
+    count += index < oldChildren.size()
+        ? countAddedNodes(*oldChildren[index], *newChildren[index])
+        : countNodes(*newChildren[index]);
+  }
+  return count;
+}
+
+} // namespace
+
+RevisionRetentionTracker::Stats RevisionRetentionTracker::track(
+    const RootShadowNode::Shared& rootShadowNode,
+    const RootShadowNode::Shared& previousRootShadowNode) {
+  std::scoped_lock lock(mutex_);
+
+  // Entries are identified by their control blocks, which (unlike
+  // `weak_ptr::lock`) never extends the lifetime of a root shadow node.
+  auto isPreviousTracked = false;
+  if (previousRootShadowNode && !entries_.empty()) {
+    const auto& last = entries_.back().rootShadowNode;
+    isPreviousTracked = !last.owner_before(previousRootShadowNode) &&
+        !previousRootShadowNode.owner_before(last);
+  }
+
+  auto entry = Entry{rootShadowNode, 0, 0};
+  if (isPreviousTracked) {
+    // Nodes shared by the two revisions are the same in both directions, so
+    // the total follows from the nodes added and removed along changed paths.
+    entry.addedNodes =
+        countAddedNodes(*previousRootShadowNode, *rootShadowNode);
+    entry.totalNodes = entries_.back().totalNodes + entry.addedNodes -
+        countAddedNodes(*rootShadowNode, *previousRootShadowNode);
+  } else {
+    entry.totalNodes = countNodes(*rootShadowNode);
+    entry.addedNodes = entry.totalNodes;
+  }
+
+  entries_.push_back(std::move(entry));
+  return update();
+}
+
+RevisionRetentionTracker::Stats RevisionRetentionTracker::getStats() const {
+  std::scoped_lock lock(mutex_);
+  return update();
+}
+
+void RevisionRetentionTracker::reset() {
+  std::scoped_lock lock(mutex_);
+  entries_.clear();
+  stats_ = {};
+}
+
+RevisionRetentionTracker::Stats RevisionRetentionTracker::update() const {
+  auto retainedNodes = size_t{0};
+  auto hasLiveEntry = false;
+  // Upper bound of nodes of the destroyed revisions since the last live one
+  // which are not shared with that live revision.
+  auto removedAddedNodes = size_t{0};
+  auto liveEntries = std::vector<Entry>{};
+  liveEntries.reserve(entries_.size());
+
+  for (auto& entry : entries_) {
+    if (entry.rootShadowNode.expired()) {
+      removedAddedNodes += entry.addedNodes;
+      continue;
+    }
+
+    if (!hasLiveEntry) {
+      entry.addedNodes = entry.totalNodes;
+    } else if (removedAddedNodes != 0) {
+      // A node of this revision missing from the previous live one is either
+      // missing from the destroyed revision in between or was added by it.
+      entry.addedNodes =
+          std::min(entry.totalNodes, entry.addedNodes + removedAddedNodes);
+    }
+    hasLiveEntry = true;
+    removedAddedNodes = 0;
+
+    retainedNodes += entry.addedNodes;
+    liveEntries.push_back(std::move(entry));
+  }
+
+  entries_ = std::move(liveEntries);
+
+  stats_.liveRevisions = entries_.size();
+  stats_.retainedNodes = retainedNodes;
+  stats_.peakRetainedNodes =
+      std::max(stats_.peakRetainedNodes, stats_.retainedNodes);
+  return stats_;
+}
+
+} // namespace facebook::react
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <react/renderer/components/root/RootShadowNode.h>
+
+namespace facebook::react {
+
+/*
+ * Accounts for the revisions of a shadow tree which are still alive and the
+ * shadow nodes they keep alive. Revisions are tracked weakly, so anything that
+ * retains an old root shadow node (the `MountingCoordinator` itself, mount
+ * hooks, `LayoutAnimationKeyFrameManager`, ...) is accounted for.
+ * The tracker never retains a root shadow node, not even temporarily, so a
+ * revision is never destroyed by (or under the lock of) the tracker.
+ * The class is thread-safe.
+ */
+class RevisionRetentionTracker final {
+ public:
+  struct Stats {
+    /*
+     * Number of tracked revisions whose root shadow node is still alive.
+     */
+    size_t liveRevisions{0};
+
+    /*
+     * Number of distinct shadow nodes retained by the live revisions. Nodes
+     * shared between consecutive revisions are counted once; nodes that only
+     * moved to a different index, and nodes of revisions whose predecessor
+     * was destroyed, may be counted again, so this is an upper bound.
+     */
+    size_t retainedNodes{0};
+
+    /*
+     * Highest `retainedNodes` observed so far.
+     */
+    size_t peakRetainedNodes{0};
+  };
+
+  /*
+   * Starts tracking a newly committed revision and returns updated stats.
+   * `previousRootShadowNode` is the revision it was committed on top of (if
+   * the caller still holds it); only the parts of the tree which differ from
+   * it are visited. Both roots must be kept alive by the caller for the
+   * duration of the call. Revisions must be tracked in commit order.
+   */
+  Stats track(
+      const RootShadowNode::Shared& rootShadowNode,
+      const RootShadowNode::Shared& previousRootShadowNode);
+
+  /*
+   * Returns up to date stats.
+   */
+  Stats getStats() const;
+
+  /*
+   * Stops tracking all revisions and clears the stats.
+   */
+  void reset();
+
+ private:
+  struct Entry {
+    std::weak_ptr<const RootShadowNode> rootShadowNode;
+
+    /*
+     * Upper bound of nodes of this revision which are not shared with the
+     * previous live revision (or all nodes if there is no such revision).
+     */
+    size_t addedNodes;
+
+    /*
+     * All nodes of this revision.
+     */
+    size_t totalNodes;
+  };
+
+  Stats update() const;
+
+  mutable std::mutex mutex_;
+  mutable std::vector<Entry> entries_;
+  mutable Stats stats_;
+};
+
+} // namespace facebook::react
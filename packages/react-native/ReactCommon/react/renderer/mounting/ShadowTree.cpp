@@ -12,7 +12,9 @@
 #include <react/renderer/components/view/ViewShadowNode.h>
 #include <react/renderer/core/LayoutContext.h>
 #include <react/renderer/core/LayoutPrimitives.h>
+#include <react/renderer/core/ObsoleteStateRegistry.h>
 #include <react/renderer/debug/SystraceSection.h>
+#include <react/renderer/mounting/RevisionReclaimer.h>
 #include <react/renderer/mounting/ShadowTreeRevision.h>
 #include <react/renderer/mounting/ShadowViewMutation.h>
 #include <react/renderer/telemetry/TransactionTelemetry.h>
@@ -25,56 +27,57 @@ namespace facebook::react {
 using CommitStatus = ShadowTree::CommitStatus;
 using CommitMode = ShadowTree::CommitMode;
 
+/*
+ * Returns the node of the given family inside the given tree, or `nullptr` if
+ * the family is not part of it.
+ */
+static const ShadowNode* findShadowNode(
+    const ShadowNode& rootShadowNode,
+    const ShadowNodeFamily& family) {
+  if (&rootShadowNode.getFamily() == &family) {
+    return &rootShadowNode;
+  }
+
+  auto ancestors = family.getAncestors(rootShadowNode);
+  if (ancestors.empty()) {
+    return nullptr;
+  }
+
+  auto& parent = ancestors.back();
+  return parent.first.get().getChildren().at(parent.second).get();
+}
+
 // --- Clone-less progress state algorithm ---
 // Note: Ideally, we don't have to const_cast but our use of constness in
 // C++ is overly restrictive. We do const_cast here but the only place where
 // we change ShadowNode is by calling `ShadowNode::progressStateIfNecessary`
 // where checks are in place to avoid manipulating a sealed ShadowNode.
 
-static void progressStateIfNecessary(ShadowNode& newShadowNode) {
-  newShadowNode.progressStateIfNecessary();
-
-  for (const auto& childNode : newShadowNode.getChildren()) {
-    progressStateIfNecessary(const_cast<ShadowNode&>(*childNode));
-  }
-}
-
+/*
+ * Progresses obsolete `State` objects of the tree in place. Only the nodes of
+ * the families registered in `ObsoleteStateRegistry` are visited.
+ * Entries of families the tree is up to date with are appended to
+ * `settledEntries`; they can leave the registry once the tree is committed.
+ */
 static void progressStateIfNecessary(
-    ShadowNode& newShadowNode,
-    const ShadowNode& baseShadowNode) {
-  newShadowNode.progressStateIfNecessary();
+    const ShadowNode& rootShadowNode,
+    std::vector<ObsoleteStateRegistry::Entry>& settledEntries) {
+  auto& registry = ObsoleteStateRegistry::shared();
 
-  auto& newChildren = newShadowNode.getChildren();
-  auto& baseChildren = baseShadowNode.getChildren();
-
-  auto newChildrenSize = newChildren.size();
-  auto baseChildrenSize = baseChildren.size();
-  auto index = size_t{0};
-
-  for (index = 0; index < newChildrenSize && index < baseChildrenSize;
-       ++index) {
-    const auto& newChildNode = *newChildren[index];
-    const auto& baseChildNode = *baseChildren[index];
-
-    if (&newChildNode == &baseChildNode) {
-      // Nodes are identical. They are shared between `newShadowNode` and
-      // `baseShadowNode` and it is safe to skipping.
+  for (const auto& entry : registry.get(rootShadowNode.getSurfaceId())) {
+    auto shadowNode = findShadowNode(rootShadowNode, *entry.family);
+    if (shadowNode == nullptr) {
       continue;
     }
 
-    if (!ShadowNode::sameFamily(newChildNode, baseChildNode)) {
-      // The nodes are not of the same family. Tree hierarchy has changed
-      // and we have to fall back to full sub-tree traversal from this point on.
-      break;
+    const auto& state = shadowNode->getState();
+    if (!state || !state->getMostRecentStateIfObsolete()) {
+      // The tree is up to date with the family: nothing to track anymore.
+      settledEntries.push_back(entry);
+      continue;
     }
 
-    progressStateIfNecessary(
-        const_cast<ShadowNode&>(newChildNode), baseChildNode);
-  }
-
-  for (; index < newChildrenSize; ++index) {
-    const auto& newChildNode = *newChildren[index];
-    progressStateIfNecessary(const_cast<ShadowNode&>(newChildNode));
+    const_cast<ShadowNode*>(shadowNode)->progressStateIfNecessary();
   }
 }
 // --- End of Clone-less progress state algorithm ---
@@ -84,134 +87,51 @@ static void progressStateIfNecessary(
  * objects. If all `State` objects in the tree are not obsolete for the moment
  * of calling, the function returns `nullptr` (as an indication that no
  * additional work is required).
- */
-static ShadowNode::Unshared progressState(const ShadowNode& shadowNode) {
-  auto isStateChanged = false;
-  auto areChildrenChanged = false;
-
-  auto newState = shadowNode.getState();
-  if (newState) {
-    newState = newState->getMostRecentStateIfObsolete();
-    if (newState) {
-      isStateChanged = true;
-    }
-  }
-
-  auto newChildren = ShadowNode::ListOfShared{};
-  if (!shadowNode.getChildren().empty()) {
-    auto index = size_t{0};
-    for (const auto& childNode : shadowNode.getChildren()) {
-      auto newChildNode = progressState(*childNode);
-      if (newChildNode) {
-        if (!areChildrenChanged) {
-          // Making a copy before the first mutation.
-          newChildren = shadowNode.getChildren();
-        }
-        newChildren[index] = newChildNode;
-        areChildrenChanged = true;
-      }
-      index++;
-    }
-  }
-
-  if (!areChildrenChanged && !isStateChanged) {
-    return nullptr;
-  }
-
-  return shadowNode.clone({
-      ShadowNodeFragment::propsPlaceholder(),
-      areChildrenChanged ? std::make_shared<ShadowNode::ListOfShared const>(
-                               std::move(newChildren))
-                         : ShadowNodeFragment::childrenPlaceholder(),
-      isStateChanged ? newState : ShadowNodeFragment::statePlaceholder(),
-  });
-}
-
-/*
- * An optimized version of the previous function (and relies on it).
- * The function uses a given base tree to exclude unchanged (equal) parts
- * of the three from the traversing.
+ * Only the nodes of the families registered in `ObsoleteStateRegistry` and
+ * their ancestors are visited and cloned.
+ * Entries of families the tree is up to date with are appended to
+ * `settledEntries`; they can leave the registry once the tree is committed.
  */
 static ShadowNode::Unshared progressState(
-    const ShadowNode& shadowNode,
-    const ShadowNode& baseShadowNode) {
-  // The intuition behind the complexity:
-  // - A very few nodes have associated state, therefore it's mostly reading and
-  //   it only writes when state objects were found obsolete;
-  // - Most before-after trees are aligned, therefore most tree branches will be
-  //   skipped;
-  // - If trees are significantly different, any other algorithm will have
-  //   close to linear complexity.
-
-  auto isStateChanged = false;
-  auto areChildrenChanged = false;
-
-  auto newState = shadowNode.getState();
-  if (newState) {
-    newState = newState->getMostRecentStateIfObsolete();
-    if (newState) {
-      isStateChanged = true;
-    }
-  }
-
-  auto& children = shadowNode.getChildren();
-  auto& baseChildren = baseShadowNode.getChildren();
-  auto newChildren = ShadowNode::ListOfShared{};
-
-  auto childrenSize = children.size();
-  auto baseChildrenSize = baseChildren.size();
-  auto index = size_t{0};
-
-  // Stage 1: Aligned part.
-  for (index = 0; index < childrenSize && index < baseChildrenSize; index++) {
-    const auto& childNode = *children[index];
-    const auto& baseChildNode = *baseChildren[index];
-
-    if (&childNode == &baseChildNode) {
-      // Nodes are identical, skipping.
+    const ShadowNode& rootShadowNode,
+    std::vector<ObsoleteStateRegistry::Entry>& settledEntries) {
+  auto& registry = ObsoleteStateRegistry::shared();
+  auto newRootShadowNode = ShadowNode::Unshared{};
+
+  for (const auto& entry : registry.get(rootShadowNode.getSurfaceId())) {
+    const auto& currentRootShadowNode =
+        newRootShadowNode ? *newRootShadowNode : rootShadowNode;
+    auto shadowNode = findShadowNode(currentRootShadowNode, *entry.family);
+    if (shadowNode == nullptr) {
       continue;
     }
 
-    if (!ShadowNode::sameFamily(childNode, baseChildNode)) {
-      // Totally different nodes, updating is impossible.
-      break;
-    }
-
-    auto newChildNode = progressState(childNode, baseChildNode);
-    if (newChildNode) {
-      if (!areChildrenChanged) {
-        // Making a copy before the first mutation.
-        newChildren = children;
-      }
-      newChildren[index] = newChildNode;
-      areChildrenChanged = true;
+    auto newState = shadowNode->getState();
+    if (newState) {
+      newState = newState->getMostRecentStateIfObsolete();
     }
-  }
-
-  // Stage 2: Misaligned part.
-  for (; index < childrenSize; index++) {
-    auto newChildNode = progressState(*children[index]);
-    if (newChildNode) {
-      if (!areChildrenChanged) {
-        // Making a copy before the first mutation.
-        newChildren = children;
-      }
-      newChildren[index] = newChildNode;
-      areChildrenChanged = true;
+    if (!newState) {
+      // The tree is up to date with the family: nothing to track anymore.
+      // Entries with obsolete states stay, since the tree they came from may
+      // be committed again.
+      settledEntries.push_back(entry);
+      continue;
     }
-  }
 
-  if (!areChildrenChanged && !isStateChanged) {
-    return nullptr;
+    auto callback = [&](const ShadowNode& oldShadowNode) {
+      return oldShadowNode.clone({
+          ShadowNodeFragment::propsPlaceholder(),
+          ShadowNodeFragment::childrenPlaceholder(),
+          newState,
+      });
+    };
+
+    newRootShadowNode = shadowNode == &currentRootShadowNode
+        ? callback(currentRootShadowNode)
+        : currentRootShadowNode.cloneTree(*entry.family, callback);
   }
 
-  return shadowNode.clone({
-      ShadowNodeFragment::propsPlaceholder(),
-      areChildrenChanged ? std::make_shared<ShadowNode::ListOfShared const>(
-                               std::move(newChildren))
-                         : ShadowNodeFragment::childrenPlaceholder(),
-      isStateChanged ? newState : ShadowNodeFragment::statePlaceholder(),
-  });
+  return newRootShadowNode;
 }
 
 static void updateMountedFlag(
@@ -278,7 +198,8 @@ ShadowTree::ShadowTree(
     const LayoutConstraints& layoutConstraints,
     const LayoutContext& layoutContext,
     const ShadowTreeDelegate& delegate,
-    const ContextContainer& contextContainer)
+    const ContextContainer& contextContainer,
+    EventDispatcher::Shared eventDispatcher)
     : surfaceId_(surfaceId), delegate_(delegate) {
   static auto globalRootComponentDescriptor =
       std::make_unique<const RootComponentDescriptor>(
@@ -292,7 +213,7 @@ ShadowTree::ShadowTree(
       layoutContext);
 
   auto family = globalRootComponentDescriptor->createFamily(
-      {surfaceId, surfaceId, nullptr});
+      {surfaceId, surfaceId, nullptr, std::move(eventDispatcher)});
 
   auto rootShadowNode = std::static_pointer_cast<const RootShadowNode>(
       globalRootComponentDescriptor->createShadowNode(
@@ -312,6 +233,7 @@ ShadowTree::ShadowTree(
 
 ShadowTree::~ShadowTree() {
   mountingCoordinator_->revoke();
+  ObsoleteStateRegistry::shared().removeSurface(surfaceId_);
 }
 
 Tag ShadowTree::getSurfaceId() const {
@@ -397,12 +319,15 @@ CommitStatus ShadowTree::tryCommit(
     return CommitStatus::Cancelled;
   }
 
+  // Registry entries are only removed once the commit succeeds: if it fails,
+  // the current tree may still hold obsolete states of these families.
+  auto settledEntries = std::vector<ObsoleteStateRegistry::Entry>{};
   if (commitOptions.enableStateReconciliation) {
     if (CoreFeatures::enableClonelessStateProgression) {
-      progressStateIfNecessary(*newRootShadowNode, *oldRootShadowNode);
+      progressStateIfNecessary(*newRootShadowNode, settledEntries);
     } else {
       auto updatedNewRootShadowNode =
-          progressState(*newRootShadowNode, *oldRootShadowNode);
+          progressState(*newRootShadowNode, settledEntries);
       if (updatedNewRootShadowNode) {
         newRootShadowNode =
             std::static_pointer_cast<RootShadowNode>(updatedNewRootShadowNode);
@@ -476,12 +401,26 @@ CommitStatus ShadowTree::tryCommit(
     }
   }
 
+  // Only commits coming from React reconcile state, so dropping the entries
+  // relies on this invariant: once React commits a tree that holds the most
+  // recent state of a family, the nodes it builds later descend from that
+  // tree, so its later commits never carry an obsolete state of the family.
+  // A newer state registers the family again (with a new generation).
+  react_native_assert(
+      settledEntries.empty() || commitOptions.enableStateReconciliation);
+  auto& registry = ObsoleteStateRegistry::shared();
+  for (const auto& entry : settledEntries) {
+    registry.remove(entry);
+  }
+
   emitLayoutEvents(affectedLayoutableNodes);
 
   if (commitMode == CommitMode::Normal) {
     mount(std::move(newRevision), commitOptions.mountSynchronously);
   }
 
+  RevisionReclaimer::shared().retire(std::move(oldRevision.rootShadowNode));
+
   return CommitStatus::Succeeded;
 }
 
@@ -74,13 +74,16 @@ class ShadowTree final {
 
   /*
    * Creates a new shadow tree instance.
+   * `eventDispatcher` dispatches the state updates of the root node; see
+   * `ShadowNodeFamilyFragment::eventDispatcher`.
    */
   ShadowTree(
       SurfaceId surfaceId,
       const LayoutConstraints& layoutConstraints,
       const LayoutContext& layoutContext,
       const ShadowTreeDelegate& delegate,
-      const ContextContainer& contextContainer);
+      const ContextContainer& contextContainer,
+      EventDispatcher::Shared eventDispatcher = nullptr);
 
   ~ShadowTree();
 
@@ -7,6 +7,7 @@
 
 #include "ShadowViewMutation.h"
 
+#include <algorithm>
 #include <utility>
 
 namespace facebook::react {
@@ -16,6 +17,7 @@ namespace facebook::react {
  * These flags should be treated as temporary.
  */
 bool ShadowViewMutation::PlatformSupportsRemoveDeleteTreeInstruction = false;
+bool ShadowViewMutation::PlatformSupportsMoveInstruction = false;
 
 ShadowViewMutation ShadowViewMutation::CreateMutation(ShadowView shadowView) {
   return {
@@ -81,6 +83,22 @@ ShadowViewMutation ShadowViewMutation::RemoveDeleteTreeMutation(
   };
 }
 
+ShadowViewMutation ShadowViewMutation::MoveMutation(
+    ShadowView parentShadowView,
+    ShadowView childShadowView,
+    int fromIndex,
+    int index) {
+  auto mutation = ShadowViewMutation{
+      /* .type = */ Move,
+      /* .parentShadowView = */ std::move(parentShadowView),
+      /* .oldChildShadowView = */ {},
+      /* .newChildShadowView = */ std::move(childShadowView),
+      /* .index = */ index,
+  };
+  mutation.fromIndex = fromIndex;
+  return mutation;
+}
+
 ShadowViewMutation ShadowViewMutation::UpdateMutation(
     ShadowView oldChildShadowView,
     ShadowView newChildShadowView,
@@ -124,6 +142,36 @@ ShadowViewMutation::ShadowViewMutation(
       index(index),
       isRedundantOperation(isRedundantOperation) {}
 
+ShadowViewMutationList expandMoveMutations(ShadowViewMutationList mutations) {
+  auto hasMoves = std::any_of(
+      mutations.begin(), mutations.end(), [](const auto& mutation) {
+        return mutation.type == ShadowViewMutation::Move;
+      });
+  if (!hasMoves) {
+    return mutations;
+  }
+
+  auto expandedMutations = ShadowViewMutationList{};
+  expandedMutations.reserve(mutations.size() * 2);
+  for (auto& mutation : mutations) {
+    if (mutation.type != ShadowViewMutation::Move) {
+      expandedMutations.push_back(std::move(mutation));
+      continue;
+    }
+
+    // `Remove` mutations of reordered children carry the new shadow view too.
+    expandedMutations.push_back(ShadowViewMutation::RemoveMutation(
+        mutation.parentShadowView,
+        mutation.newChildShadowView,
+        mutation.fromIndex));
+    expandedMutations.push_back(ShadowViewMutation::InsertMutation(
+        std::move(mutation.parentShadowView),
+        std::move(mutation.newChildShadowView),
+        mutation.index));
+  }
+  return expandedMutations;
+}
+
 #if RN_DEBUG_STRING_CONVERTIBLE
 
 std::string getDebugName(const ShadowViewMutation& mutation) {
@@ -140,6 +188,8 @@ std::string getDebugName(const ShadowViewMutation& mutation) {
       return "Update";
     case ShadowViewMutation::RemoveDeleteTree:
       return "RemoveDeleteTree";
+    case ShadowViewMutation::Move:
+      return "Move";
   }
 }
 
@@ -170,6 +220,11 @@ std::vector<DebugStringConvertibleObject> getDebugProps(
                                          getDebugDescription(
                                              mutation.index, options)}
           : DebugStringConvertibleObject{},
+      mutation.fromIndex != -1
+          ? DebugStringConvertibleObject{"fromIndex",
+                                         getDebugDescription(
+                                             mutation.fromIndex, options)}
+          : DebugStringConvertibleObject{},
   };
 }
 
@@ -28,6 +28,16 @@ struct ShadowViewMutation final {
 
   static bool PlatformSupportsRemoveDeleteTreeInstruction;
 
+  /*
+   * When enabled, children reordered within the same parent are described
+   * with `Move` mutations instead of `Remove` + `Insert` pairs.
+   * Disabled on every platform for now: the iOS and Android mounting layers
+   * still apply a `Move` as a removal followed by an insertion, so enabling
+   * it would only make transactions smaller, without sparing the host views
+   * from being detached and reattached.
+   */
+  static bool PlatformSupportsMoveInstruction;
+
 #pragma mark - Designated Initializers
 
   /*
@@ -70,6 +80,20 @@ struct ShadowViewMutation final {
       ShadowView childShadowView,
       int index);
 
+  /*
+   * Creates and returns a `Move` mutation.
+   * This moves a mounted child from `fromIndex` to `index` within the same
+   * parent; it is equivalent to a `Remove` at `fromIndex` followed by an
+   * `Insert` at `index`. Both indices are relative to the children of the
+   * parent at the moment the mutation is applied. Whether the host view stays
+   * attached in the meantime is up to the mounting layer.
+   */
+  static ShadowViewMutation MoveMutation(
+      ShadowView parentShadowView,
+      ShadowView childShadowView,
+      int fromIndex,
+      int index);
+
   /*
    * Creates and returns an `Update` mutation.
    */
@@ -86,7 +110,8 @@ struct ShadowViewMutation final {
     Insert = 4,
     Remove = 8,
     Update = 16,
-    RemoveDeleteTree = 32
+    RemoveDeleteTree = 32,
+    Move = 64
   };
 
 #pragma mark - Fields
@@ -97,6 +122,9 @@ struct ShadowViewMutation final {
   ShadowView newChildShadowView = {};
   int index = -1;
 
+  // Index the child is moved from. Set for `Move` mutations only.
+  int fromIndex = -1;
+
   // RemoveDeleteTree causes many Remove/Delete operations to be redundant.
   // However, we must internally produce all of them for any consumers that
   // rely on explicit instructions to remove/delete every node in the tree.
@@ -122,6 +150,12 @@ struct ShadowViewMutation final {
 
 using ShadowViewMutationList = std::vector<ShadowViewMutation>;
 
+/*
+ * Replaces every `Move` mutation with the equivalent `Remove` + `Insert` pair,
+ * for consumers which don't handle `Move` (e.g. `MountingOverrideDelegate`s).
+ */
+ShadowViewMutationList expandMoveMutations(ShadowViewMutationList mutations);
+
 #if RN_DEBUG_STRING_CONVERTIBLE
 
 std::string getDebugName(const ShadowViewMutation& mutation);
@@ -210,6 +210,40 @@ void StubViewTree::mutate(const ShadowViewMutationList& mutations) {
         break;
       }
 
+      case ShadowViewMutation::Move: {
+        if (!mutation.mutatedViewIsVirtual()) {
+          react_native_assert(mutation.oldChildShadowView == ShadowView{});
+          auto parentTag = mutation.parentShadowView.tag;
+          auto childTag = mutation.newChildShadowView.tag;
+          react_native_assert(hasTag(parentTag));
+          auto parentStubView = registry_[parentTag];
+          react_native_assert(hasTag(childTag));
+          auto childStubView = registry_[childTag];
+          STUB_VIEW_LOG({
+            LOG(ERROR) << "StubView: Move [" << childTag << "] within ["
+                       << parentTag << "] from @" << mutation.fromIndex
+                       << " to @" << mutation.index << " ("
+                       << parentStubView->children.size() << " children)";
+          });
+          react_native_assert(childStubView->parentTag == parentTag);
+          react_native_assert(
+              mutation.fromIndex >= 0 &&
+              parentStubView->children.size() >
+                  static_cast<size_t>(mutation.fromIndex) &&
+              parentStubView->children[mutation.fromIndex]->tag == childTag);
+          parentStubView->children.erase(
+              parentStubView->children.begin() + mutation.fromIndex);
+          react_native_assert(
+              mutation.index >= 0 &&
+              parentStubView->children.size() >=
+                  static_cast<size_t>(mutation.index));
+          parentStubView->children.insert(
+              parentStubView->children.begin() + mutation.index, childStubView);
+          childStubView->update(mutation.newChildShadowView);
+        }
+        break;
+      }
+
       case ShadowViewMutation::Update: {
         STUB_VIEW_LOG({
           LOG(ERROR) << "StubView: Update [" << mutation.newChildShadowView.tag
@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <react/renderer/components/root/RootComponentDescriptor.h>
+#include <react/renderer/components/view/ViewComponentDescriptor.h>
+#include <react/renderer/element/ComponentBuilder.h>
+#include <react/renderer/element/Element.h>
+#include <react/renderer/element/testUtils.h>
+#include <react/renderer/mounting/Differentiator.h>
+#include <react/renderer/mounting/ShadowViewMutation.h>
+#include <react/renderer/mounting/stubs.h>
+
+namespace facebook::react {
+
+class MoveMutationTest : public ::testing::Test {
+ protected:
+  static constexpr int kChildCount = 1000;
+
+  ComponentBuilder builder_;
+  std::shared_ptr<RootShadowNode> rootShadowNode_;
+
+  MoveMutationTest() : builder_(simpleComponentBuilder()) {
+    auto children = std::vector<ElementFragment>{};
+    for (int index = 0; index < kChildCount; index++) {
+      children.push_back(viewElement(2 + index));
+    }
+
+    builder_.build(Element<RootShadowNode>()
+                       .reference(rootShadowNode_)
+                       .tag(1)
+                       .children(std::move(children)));
+    rootShadowNode_->layoutIfNeeded();
+  }
+
+  static Element<ViewShadowNode> viewElement(Tag tag) {
+    return Element<ViewShadowNode>().tag(tag).props([] {
+      auto props = std::make_shared<ViewShadowNodeProps>();
+      // To ensure it won't get flattened.
+      props->backgroundColor = blackColor();
+      return props;
+    });
+  }
+
+  ~MoveMutationTest() override {
+    ShadowViewMutation::PlatformSupportsMoveInstruction = false;
+  }
+
+  std::shared_ptr<RootShadowNode> reorderChildren(
+      const std::function<void(ShadowNode::ListOfShared& children)>&
+          callback) {
+    auto children = rootShadowNode_->getChildren();
+    callback(children);
+    auto rootShadowNode = std::static_pointer_cast<RootShadowNode>(
+        rootShadowNode_->ShadowNode::clone({
+            ShadowNodeFragment::propsPlaceholder(),
+            std::make_shared<ShadowNode::ListOfShared>(children),
+        }));
+    rootShadowNode->layoutIfNeeded();
+    return rootShadowNode;
+  }
+
+  ShadowViewMutation::List calculateMutations(
+      const RootShadowNode& newRootShadowNode) {
+    auto mutations =
+        calculateShadowViewMutations(*rootShadowNode_, newRootShadowNode);
+
+    // Applying the mutations must produce the same views as building them
+    // from scratch.
+    auto stubViewTree =
+        buildStubViewTreeWithoutUsingDifferentiator(*rootShadowNode_);
+    stubViewTree.mutate(mutations);
+    EXPECT_EQ(
+        stubViewTree,
+        buildStubViewTreeWithoutUsingDifferentiator(newRootShadowNode));
+
+    return mutations;
+  }
+
+  static size_t count(
+      const ShadowViewMutation::List& mutations,
+      ShadowViewMutation::Type type) {
+    return std::count_if(
+        mutations.begin(), mutations.end(), [&](const auto& mutation) {
+          return mutation.type == type;
+        });
+  }
+};
+
+TEST_F(MoveMutationTest, movingFirstChildToTheEndIsSingleMove) {
+  auto newRootShadowNode = reorderChildren([](auto& children) {
+    std::rotate(children.begin(), children.begin() + 1, children.end());
+  });
+
+  auto mutations = calculateMutations(*newRootShadowNode);
+  EXPECT_EQ(count(mutations, ShadowViewMutation::Remove), kChildCount - 1);
+  EXPECT_EQ(count(mutations, ShadowViewMutation::Insert), kChildCount - 1);
+
+  ShadowViewMutation::PlatformSupportsMoveInstruction = true;
+
+  mutations = calculateMutations(*newRootShadowNode);
+  EXPECT_EQ(count(mutations, ShadowViewMutation::Remove), 0);
+  EXPECT_EQ(count(mutations, ShadowViewMutation::Insert), 0);
+  ASSERT_EQ(count(mutations, ShadowViewMutation::Move), 1);
+
+  auto move = std::find_if(
+      mutations.begin(), mutations.end(), [](const auto& mutation) {
+        return mutation.type == ShadowViewMutation::Move;
+      });
+  EXPECT_EQ(move->newChildShadowView.tag, 2);
+  EXPECT_EQ(move->fromIndex, 0);
+  EXPECT_EQ(move->index, kChildCount - 1);
+}
+
+TEST_F(MoveMutationTest, shuffledChildrenNeedFewerMoves) {
+  auto newRootShadowNode = reorderChildren([](auto& children) {
+    std::shuffle(children.begin(), children.end(), std::mt19937{42});
+  });
+
+  auto mutations = calculateMutations(*newRootShadowNode);
+  auto reinsertedChildren = count(mutations, ShadowViewMutation::Insert);
+  EXPECT_EQ(count(mutations, ShadowViewMutation::Remove), reinsertedChildren);
+
+  ShadowViewMutation::PlatformSupportsMoveInstruction = true;
+
+  mutations = calculateMutations(*newRootShadowNode);
+  auto movedChildren = count(mutations, ShadowViewMutation::Move);
+  EXPECT_EQ(count(mutations, ShadowViewMutation::Remove), 0);
+  EXPECT_EQ(count(mutations, ShadowViewMutation::Insert), 0);
+  EXPECT_GT(movedChildren, 0);
+  EXPECT_LT(movedChildren, reinsertedChildren);
+}
+
+TEST_F(MoveMutationTest, insertionsAndRemovalsAreKept) {
+  auto newChild = builder_.build(viewElement(2 + kChildCount));
+  auto newRootShadowNode = reorderChildren([&](auto& children) {
+    children.erase(children.begin());
+    std::swap(children[10], children[20]);
+    children.push_back(newChild);
+  });
+
+  ShadowViewMutation::PlatformSupportsMoveInstruction = true;
+
+  auto mutations = calculateMutations(*newRootShadowNode);
+  EXPECT_EQ(count(mutations, ShadowViewMutation::Remove), 1);
+  EXPECT_EQ(count(mutations, ShadowViewMutation::Delete), 1);
+  EXPECT_EQ(count(mutations, ShadowViewMutation::Create), 1);
+  EXPECT_EQ(count(mutations, ShadowViewMutation::Insert), 1);
+  // Swapping two children which are apart takes two moves.
+  EXPECT_EQ(count(mutations, ShadowViewMutation::Move), 2);
+}
+
+TEST_F(MoveMutationTest, movesCanBeExpandedIntoRemovalsAndInsertions) {
+  auto newRootShadowNode = reorderChildren([](auto& children) {
+    std::shuffle(children.begin(), children.end(), std::mt19937{7});
+  });
+
+  ShadowViewMutation::PlatformSupportsMoveInstruction = true;
+
+  auto mutations = calculateMutations(*newRootShadowNode);
+  auto movedChildren = count(mutations, ShadowViewMutation::Move);
+  ASSERT_GT(movedChildren, 0);
+
+  auto expandedMutations = expandMoveMutations(mutations);
+  EXPECT_EQ(count(expandedMutations, ShadowViewMutation::Move), 0);
+  EXPECT_EQ(
+      count(expandedMutations, ShadowViewMutation::Remove), movedChildren);
+  EXPECT_EQ(
+      count(expandedMutations, ShadowViewMutation::Insert), movedChildren);
+
+  auto stubViewTree =
+      buildStubViewTreeWithoutUsingDifferentiator(*rootShadowNode_);
+  stubViewTree.mutate(expandedMutations);
+  EXPECT_EQ(
+      stubViewTree,
+      buildStubViewTreeWithoutUsingDifferentiator(*newRootShadowNode));
+}
+
+} // namespace facebook::react
@@ -0,0 +1,258 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <react/renderer/components/root/RootComponentDescriptor.h>
+#include <react/renderer/components/view/ViewComponentDescriptor.h>
+#include <react/renderer/element/ComponentBuilder.h>
+#include <react/renderer/element/Element.h>
+#include <react/renderer/element/testUtils.h>
+#include <react/renderer/mounting/MountingCoordinator.h>
+#include <react/renderer/mounting/MountingOverrideDelegate.h>
+#include <react/renderer/mounting/ShadowTree.h>
+#include <react/renderer/mounting/ShadowTreeDelegate.h>
+#include <react/renderer/mounting/stubs.h>
+
+using namespace facebook::react;
+
+namespace {
+
+class ChunkingShadowTreeDelegate : public ShadowTreeDelegate {
+ public:
+  RootShadowNode::Unshared shadowTreeWillCommit(
+      const ShadowTree& /*shadowTree*/,
+      const RootShadowNode::Shared& /*oldRootShadowNode*/,
+      const RootShadowNode::Unshared& newRootShadowNode) const override {
+    return newRootShadowNode;
+  };
+
+  void shadowTreeDidFinishTransaction(
+      MountingCoordinator::Shared /*mountingCoordinator*/,
+      bool /*mountSynchronously*/) const override{};
+};
+
+class PassthroughOverrideDelegate : public MountingOverrideDelegate {
+ public:
+  bool shouldOverridePullTransaction() const override {
+    return true;
+  }
+
+  std::optional<MountingTransaction> pullTransaction(
+      SurfaceId surfaceId,
+      MountingTransaction::Number number,
+      const TransactionTelemetry& telemetry,
+      ShadowViewMutationList mutations) const override {
+    if (mutations.empty()) {
+      return std::nullopt;
+    }
+    return MountingTransaction{
+        surfaceId, number, std::move(mutations), telemetry};
+  }
+};
+
+size_t countAttachedViews(const StubView& stubView) {
+  size_t count = 1;
+  for (const auto& child : stubView.children) {
+    count += countAttachedViews(*child);
+  }
+  return count;
+}
+
+} // namespace
+
+class MutationChunkingTest : public ::testing::Test {
+ public:
+  static constexpr SurfaceId kSurfaceId = 11;
+
+  MutationChunkingTest() : builder_(simpleComponentBuilder()) {
+    shadowTree_ = std::make_unique<ShadowTree>(
+        kSurfaceId,
+        LayoutConstraints{},
+        LayoutContext{},
+        shadowTreeDelegate_,
+        contextContainer_);
+
+    stubViewTree_ = buildStubViewTreeWithoutUsingDifferentiator(
+        *shadowTree_->getCurrentRevision().rootShadowNode);
+  }
+
+  /*
+   * Builds 10 sections with 10 rows with 5 cells each; every view forms a
+   * host view.
+   */
+  RootShadowNode::Shared buildScreen(size_t sectionCount = 10) {
+    auto nextTag = Tag{kSurfaceId + 1};
+    auto sections = std::vector<ElementFragment>{};
+    for (size_t sectionIndex = 0; sectionIndex < sectionCount; sectionIndex++) {
+      auto rows = std::vector<ElementFragment>{};
+      for (int rowIndex = 0; rowIndex < 10; rowIndex++) {
+        auto cells = std::vector<ElementFragment>{};
+        for (int cellIndex = 0; cellIndex < 5; cellIndex++) {
+          cells.push_back(viewElement(nextTag++));
+        }
+        rows.push_back(viewElement(nextTag++).children(std::move(cells)));
+      }
+      sections.push_back(viewElement(nextTag++).children(std::move(rows)));
+    }
+
+    return builder_.build(Element<RootShadowNode>()
+                              .tag(kSurfaceId)
+                              .surfaceId(kSurfaceId)
+                              .children(std::move(sections)));
+  }
+
+  void commit(const RootShadowNode::Shared& rootShadowNode) {
+    shadowTree_->commit(
+        [&](const RootShadowNode& /*oldRootShadowNode*/) {
+          return std::static_pointer_cast<RootShadowNode>(
+              rootShadowNode->ShadowNode::clone({}));
+        },
+        {/* .enableStateReconciliation = */ false});
+  }
+
+  /*
+   * Pulls and mounts transactions until there are none left; returns the
+   * number of transactions.
+   */
+  size_t mountAll(size_t limit, bool onlyCreatesViews = true) {
+    auto mountingCoordinator = shadowTree_->getMountingCoordinator();
+    size_t transactionCount = 0;
+    while (auto transaction = mountingCoordinator->pullTransaction()) {
+      transactionCount++;
+      if (limit != 0) {
+        EXPECT_LE(transaction->getMutations().size(), limit);
+      }
+
+      stubViewTree_.mutate(transaction->getMutations());
+
+      if (onlyCreatesViews) {
+        // No chunk leaves a created view detached.
+        EXPECT_EQ(
+            stubViewTree_.size(),
+            countAttachedViews(stubViewTree_.getRootStubView()));
+      }
+    }
+
+    EXPECT_EQ(
+        stubViewTree_,
+        buildStubViewTreeWithoutUsingDifferentiator(
+            *shadowTree_->getCurrentRevision().rootShadowNode));
+    return transactionCount;
+  }
+
+  static Element<ViewShadowNode> viewElement(Tag tag) {
+    return Element<ViewShadowNode>().tag(tag).surfaceId(kSurfaceId).props([] {
+      auto props = std::make_shared<ViewShadowNodeProps>();
+      // To ensure it won't get flattened.
+      props->backgroundColor = blackColor();
+      return props;
+    });
+  }
+
+  ComponentBuilder builder_;
+  ContextContainer contextContainer_{};
+  ChunkingShadowTreeDelegate shadowTreeDelegate_{};
+  std::unique_ptr<ShadowTree> shadowTree_;
+  StubViewTree stubViewTree_;
+};
+
+TEST_F(MutationChunkingTest, transactionsAreNotSplitByDefault) {
+  commit(buildScreen());
+
+  EXPECT_EQ(mountAll(0), 1);
+}
+
+TEST_F(MutationChunkingTest, initialRenderIsSplitIntoChunks) {
+  auto mountingCoordinator = shadowTree_->getMountingCoordinator();
+  mountingCoordinator->setMutationsPerTransactionLimit(100);
+
+  commit(buildScreen());
+
+  auto transaction = mountingCoordinator->pullTransaction();
+  ASSERT_TRUE(transaction.has_value());
+  auto progress = mountingCoordinator->getChunkingProgress();
+  EXPECT_EQ(progress.pulledMutations, transaction->getMutations().size());
+  // 610 views, each of which is created and inserted.
+  EXPECT_GE(progress.totalMutations, 1220);
+  EXPECT_TRUE(mountingCoordinator->hasPendingTransactions());
+  stubViewTree_.mutate(transaction->getMutations());
+
+  EXPECT_GE(mountAll(100), 12);
+
+  progress = mountingCoordinator->getChunkingProgress();
+  EXPECT_EQ(progress.pulledMutations, 0);
+  EXPECT_EQ(progress.totalMutations, 0);
+  EXPECT_FALSE(mountingCoordinator->hasPendingTransactions());
+}
+
+TEST_F(MutationChunkingTest, newRevisionsAreMountedAfterQueuedChunks) {
+  auto mountingCoordinator = shadowTree_->getMountingCoordinator();
+  mountingCoordinator->setMutationsPerTransactionLimit(100);
+
+  commit(buildScreen());
+
+  auto transaction = mountingCoordinator->pullTransaction();
+  ASSERT_TRUE(transaction.has_value());
+  stubViewTree_.mutate(transaction->getMutations());
+
+  // Half of the screen goes away before the first revision is fully mounted.
+  commit(buildScreen(5));
+
+  // Removed views stay detached until they are deleted, possibly by the
+  // next chunk.
+  mountAll(100, /* onlyCreatesViews */ false);
+}
+
+TEST_F(MutationChunkingTest, onlyTheFirstChunkCarriesTheRevisionTelemetry) {
+  auto mountingCoordinator = shadowTree_->getMountingCoordinator();
+  mountingCoordinator->setMutationsPerTransactionLimit(100);
+
+  commit(buildScreen());
+
+  auto first = mountingCoordinator->pullTransaction();
+  auto second = mountingCoordinator->pullTransaction();
+  ASSERT_TRUE(first.has_value());
+  ASSERT_TRUE(second.has_value());
+
+  const auto& firstTelemetry = first->getTelemetry();
+  const auto& secondTelemetry = second->getTelemetry();
+  EXPECT_LT(
+      firstTelemetry.getLayoutStartTime(), firstTelemetry.getDiffEndTime());
+  // The follow-up chunk didn't lay out, commit or diff anything.
+  EXPECT_GE(
+      secondTelemetry.getLayoutStartTime(), firstTelemetry.getDiffEndTime());
+  EXPECT_EQ(
+      secondTelemetry.getRevisionNumber(), firstTelemetry.getRevisionNumber());
+}
+
+TEST_F(MutationChunkingTest, overridingDelegateGetsWholeRevisions) {
+  auto mountingCoordinator = shadowTree_->getMountingCoordinator();
+  mountingCoordinator->setMutationsPerTransactionLimit(100);
+
+  commit(buildScreen());
+
+  auto transaction = mountingCoordinator->pullTransaction();
+  ASSERT_TRUE(transaction.has_value());
+  stubViewTree_.mutate(transaction->getMutations());
+  EXPECT_TRUE(mountingCoordinator->hasPendingTransactions());
+
+  auto overrideDelegate = std::make_shared<PassthroughOverrideDelegate>();
+  mountingCoordinator->setMountingOverrideDelegate(overrideDelegate);
+
+  // Queued chunks are flushed at once.
+  EXPECT_EQ(mountAll(0), 1);
+  EXPECT_FALSE(mountingCoordinator->hasPendingTransactions());
+
+  // New revisions are not chunked.
+  commit(buildScreen(5));
+  EXPECT_EQ(mountAll(0, /* onlyCreatesViews */ false), 1);
+}
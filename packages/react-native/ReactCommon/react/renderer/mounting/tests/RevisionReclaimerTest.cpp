@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include <react/renderer/components/view/ViewComponentDescriptor.h>
+#include <react/renderer/element/ComponentBuilder.h>
+#include <react/renderer/element/Element.h>
+#include <react/renderer/mounting/RevisionReclaimer.h>
+#include <react/utils/CoreFeatures.h>
+
+#include <react/renderer/element/testUtils.h>
+
+using namespace facebook::react;
+
+class RevisionReclaimerTest : public ::testing::Test {
+ public:
+  RevisionReclaimerTest() : builder_(simpleComponentBuilder()) {
+    CoreFeatures::enableDeferredRevisionDestruction = true;
+  }
+
+  ~RevisionReclaimerTest() override {
+    CoreFeatures::enableDeferredRevisionDestruction = false;
+  }
+
+  RootShadowNode::Shared buildTree(SurfaceId surfaceId = 1) {
+    // clang-format off
+    auto element =
+        Element<RootShadowNode>()
+          .surfaceId(surfaceId)
+          .children({
+            Element<ViewShadowNode>(),
+            Element<ViewShadowNode>()
+          });
+    // clang-format on
+
+    return builder_.build(element);
+  }
+
+  ComponentBuilder builder_;
+};
+
+TEST_F(RevisionReclaimerTest, destroysRetiredRevisions) {
+  auto reclaimer = RevisionReclaimer{};
+  auto rootShadowNode = buildTree();
+  auto weakRootShadowNode = std::weak_ptr<const RootShadowNode>{rootShadowNode};
+
+  reclaimer.retire(std::move(rootShadowNode));
+  reclaimer.drain();
+
+  EXPECT_TRUE(weakRootShadowNode.expired());
+  auto stats = reclaimer.getStats();
+  EXPECT_EQ(stats.pendingRevisions, 0);
+  EXPECT_EQ(stats.peakPendingRevisions, 1);
+  EXPECT_EQ(stats.synchronousRevisions, 0);
+}
+
+TEST_F(RevisionReclaimerTest, drainsRevisionsOfOneSurface) {
+  auto reclaimer = RevisionReclaimer{};
+  auto rootShadowNode = buildTree(1);
+  auto otherRootShadowNode = buildTree(2);
+  auto weakRootShadowNode = std::weak_ptr<const RootShadowNode>{rootShadowNode};
+  auto weakOtherRootShadowNode =
+      std::weak_ptr<const RootShadowNode>{otherRootShadowNode};
+
+  reclaimer.retire(std::move(otherRootShadowNode));
+  reclaimer.retire(std::move(rootShadowNode));
+  reclaimer.drain(1);
+
+  // The revision of the other surface may or may not be destroyed yet.
+  EXPECT_TRUE(weakRootShadowNode.expired());
+
+  reclaimer.drain(2);
+
+  EXPECT_TRUE(weakOtherRootShadowNode.expired());
+  EXPECT_EQ(reclaimer.getStats().pendingRevisions, 0);
+}
+
+TEST_F(RevisionReclaimerTest, releasesSharedRevisions) {
+  auto reclaimer = RevisionReclaimer{};
+  auto rootShadowNode = buildTree();
+
+  reclaimer.retire(rootShadowNode);
+
+  // Something else still retains the tree, so there is nothing to destroy.
+  EXPECT_EQ(rootShadowNode.use_count(), 1);
+  EXPECT_EQ(reclaimer.getStats().peakPendingRevisions, 0);
+}
+
+TEST_F(RevisionReclaimerTest, destroysSynchronouslyWhenBacklogIsFull) {
+  auto reclaimer = RevisionReclaimer{0};
+  auto rootShadowNode = buildTree();
+  auto weakRootShadowNode = std::weak_ptr<const RootShadowNode>{rootShadowNode};
+
+  reclaimer.retire(std::move(rootShadowNode));
+
+  EXPECT_TRUE(weakRootShadowNode.expired());
+  EXPECT_EQ(reclaimer.getStats().synchronousRevisions, 1);
+}
+
+TEST_F(RevisionReclaimerTest, destroysSynchronouslyWhenDisabled) {
+  CoreFeatures::enableDeferredRevisionDestruction = false;
+
+  auto reclaimer = RevisionReclaimer{};
+  auto rootShadowNode = buildTree();
+  auto weakRootShadowNode = std::weak_ptr<const RootShadowNode>{rootShadowNode};
+
+  reclaimer.retire(std::move(rootShadowNode));
+
+  EXPECT_TRUE(weakRootShadowNode.expired());
+  EXPECT_EQ(reclaimer.getStats().peakPendingRevisions, 0);
+}
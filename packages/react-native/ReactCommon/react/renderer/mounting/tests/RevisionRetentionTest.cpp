@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include <react/renderer/components/view/ViewComponentDescriptor.h>
+#include <react/renderer/element/ComponentBuilder.h>
+#include <react/renderer/element/Element.h>
+#include <react/renderer/mounting/MountingCoordinator.h>
+#include <react/renderer/mounting/ShadowTree.h>
+#include <react/renderer/mounting/ShadowTreeDelegate.h>
+#include <react/renderer/mounting/stubs.h>
+
+#include <react/renderer/element/testUtils.h>
+
+using namespace facebook::react;
+
+namespace {
+
+class RetentionShadowTreeDelegate : public ShadowTreeDelegate {
+ public:
+  RootShadowNode::Unshared shadowTreeWillCommit(
+      const ShadowTree& /*shadowTree*/,
+      const RootShadowNode::Shared& /*oldRootShadowNode*/,
+      const RootShadowNode::Unshared& newRootShadowNode) const override {
+    return newRootShadowNode;
+  };
+
+  void shadowTreeDidFinishTransaction(
+      MountingCoordinator::Shared /*mountingCoordinator*/,
+      bool /*mountSynchronously*/) const override{};
+};
+
+} // namespace
+
+class RevisionRetentionTest : public ::testing::Test {
+ public:
+  RevisionRetentionTest() : builder_(simpleComponentBuilder()) {
+    // clang-format off
+    auto element =
+        Element<RootShadowNode>()
+          .reference(rootShadowNode_)
+          .children({
+            Element<ViewShadowNode>(),
+            Element<ViewShadowNode>(),
+            Element<ViewShadowNode>()
+          });
+    // clang-format on
+
+    builder_.build(element);
+
+    shadowTree_ = std::make_unique<ShadowTree>(
+        SurfaceId{11},
+        LayoutConstraints{},
+        LayoutContext{},
+        shadowTreeDelegate_,
+        contextContainer_);
+  }
+
+  RootShadowNode::Shared commit(const RootShadowNode::Shared& rootShadowNode) {
+    auto newRootShadowNode = std::static_pointer_cast<RootShadowNode>(
+        rootShadowNode->ShadowNode::clone({}));
+    shadowTree_->commit(
+        [&](const RootShadowNode& /*oldRootShadowNode*/) {
+          return newRootShadowNode;
+        },
+        {/* .enableStateReconciliation = */ false});
+    return newRootShadowNode;
+  }
+
+  MountingCoordinator::Shared getMountingCoordinator() const {
+    return shadowTree_->getMountingCoordinator();
+  }
+
+  ComponentBuilder builder_;
+  ContextContainer contextContainer_{};
+  RetentionShadowTreeDelegate shadowTreeDelegate_{};
+  std::shared_ptr<RootShadowNode> rootShadowNode_;
+  std::unique_ptr<ShadowTree> shadowTree_;
+};
+
+TEST_F(RevisionRetentionTest, revisionsAreNotTrackedByDefault) {
+  auto mountingCoordinator = getMountingCoordinator();
+
+  commit(rootShadowNode_);
+
+  EXPECT_EQ(mountingCoordinator->getRetentionStats().liveRevisions, 0);
+  EXPECT_EQ(mountingCoordinator->getRetentionStats().retainedNodes, 0);
+}
+
+TEST_F(RevisionRetentionTest, countsLiveRevisions) {
+  auto mountingCoordinator = getMountingCoordinator();
+  mountingCoordinator->setRetentionTrackingEnabled(true);
+
+  commit(rootShadowNode_);
+
+  // The initial (base) revision and the committed one.
+  EXPECT_EQ(mountingCoordinator->getRetentionStats().liveRevisions, 2);
+
+  mountingCoordinator->pullTransaction();
+
+  EXPECT_EQ(mountingCoordinator->getRetentionStats().liveRevisions, 1);
+}
+
+TEST_F(RevisionRetentionTest, countsRevisionsRetainedOutsideOfCoordinator) {
+  auto mountingCoordinator = getMountingCoordinator();
+  mountingCoordinator->setRetentionTrackingEnabled(true);
+
+  // Something (e.g. a mount hook) keeps the mounted tree alive.
+  auto retainedRootShadowNode = commit(rootShadowNode_);
+  mountingCoordinator->pullTransaction();
+  commit(retainedRootShadowNode);
+  mountingCoordinator->pullTransaction();
+
+  auto stats = mountingCoordinator->getRetentionStats();
+  EXPECT_EQ(stats.liveRevisions, 2);
+  // Four nodes in the retained revision, plus the root of the newer one which
+  // shares all of its children.
+  EXPECT_EQ(stats.retainedNodes, 5);
+
+  retainedRootShadowNode.reset();
+
+  stats = mountingCoordinator->getRetentionStats();
+  EXPECT_EQ(stats.liveRevisions, 1);
+  EXPECT_EQ(stats.retainedNodes, 4);
+  EXPECT_EQ(stats.peakRetainedNodes, 5);
+}
+
+TEST_F(RevisionRetentionTest, diffsOnPullAboveRetainedNodesLimit) {
+  auto mountingCoordinator = getMountingCoordinator();
+  mountingCoordinator->pullTransaction();
+
+  auto stubViewTree = buildStubViewTreeWithoutUsingDifferentiator(
+      *shadowTree_->getCurrentRevision().rootShadowNode);
+  auto baseRootShadowNode =
+      mountingCoordinator->getBaseRevision().rootShadowNode;
+
+  mountingCoordinator->setRetainedNodesLimit(4);
+
+  auto rootShadowNode = commit(rootShadowNode_);
+  rootShadowNode = commit(rootShadowNode);
+
+  // Nothing is diffed on the committing thread.
+  EXPECT_EQ(mountingCoordinator->getForcedDiffCount(), 0);
+  EXPECT_EQ(
+      mountingCoordinator->getBaseRevision().rootShadowNode,
+      baseRootShadowNode);
+  EXPECT_TRUE(mountingCoordinator->hasPendingTransactions());
+
+  auto transaction = mountingCoordinator->pullTransaction();
+  ASSERT_TRUE(transaction.has_value());
+  EXPECT_EQ(mountingCoordinator->getForcedDiffCount(), 1);
+  EXPECT_FALSE(mountingCoordinator->hasPendingTransactions());
+  EXPECT_FALSE(mountingCoordinator->pullTransaction().has_value());
+  EXPECT_EQ(mountingCoordinator->getForcedDiffCount(), 1);
+
+  stubViewTree.mutate(transaction->getMutations());
+  EXPECT_EQ(
+      stubViewTree,
+      buildStubViewTreeWithoutUsingDifferentiator(*rootShadowNode));
+}
@@ -20,6 +20,7 @@
 #include <react/renderer/mounting/stubs.h>
 #include <react/test_utils/Entropy.h>
 #include <react/test_utils/shadowTreeGeneration.h>
+#include <react/utils/CoreFeatures.h>
 
 // Uncomment when random test blocks are uncommented below.
 // #include <algorithm>
@@ -80,8 +81,9 @@ static void testShadowNodeTreeLifeCycle(
 
     // Building an initial view hierarchy.
     auto viewTree = buildStubViewTreeWithoutUsingDifferentiator(*emptyRootNode);
-    viewTree.mutate(
-        calculateShadowViewMutations(*emptyRootNode, *currentRootNode));
+    auto viewLayerCache = ViewLayerCache{};
+    viewTree.mutate(calculateShadowViewMutations(
+        *emptyRootNode, *currentRootNode, &viewLayerCache));
 
     for (int j = 0; j < stages; j++) {
       auto nextRootNode = currentRootNode;
@@ -107,8 +109,8 @@ static void testShadowNodeTreeLifeCycle(
       allNodes.push_back(nextRootNode);
 
       // Calculating mutations.
-      auto mutations =
-          calculateShadowViewMutations(*currentRootNode, *nextRootNode);
+      auto mutations = calculateShadowViewMutations(
+          *currentRootNode, *nextRootNode, &viewLayerCache);
 
       // Make sure that in a single frame, a DELETE for a
       // view is not followed by a CREATE for the same view.
@@ -231,8 +233,9 @@ static void testShadowNodeTreeLifeCycleExtensiveFlatteningUnflattening(
 
     // Building an initial view hierarchy.
     auto viewTree = buildStubViewTreeWithoutUsingDifferentiator(*emptyRootNode);
-    viewTree.mutate(
-        calculateShadowViewMutations(*emptyRootNode, *currentRootNode));
+    auto viewLayerCache = ViewLayerCache{};
+    viewTree.mutate(calculateShadowViewMutations(
+        *emptyRootNode, *currentRootNode, &viewLayerCache));
 
     for (int j = 0; j < stages; j++) {
       auto nextRootNode = currentRootNode;
@@ -259,8 +262,8 @@ static void testShadowNodeTreeLifeCycleExtensiveFlatteningUnflattening(
       allNodes.push_back(nextRootNode);
 
       // Calculating mutations.
-      auto mutations =
-          calculateShadowViewMutations(*currentRootNode, *nextRootNode);
+      auto mutations = calculateShadowViewMutations(
+          *currentRootNode, *nextRootNode, &viewLayerCache);
 
       // Make sure that in a single frame, a DELETE for a
       // view is not followed by a CREATE for the same view.
@@ -391,6 +394,50 @@ TEST(
       /* stages */ 32);
 }
 
+TEST(ShadowTreeLifecycleTest, stableSmallerTreeMoreIterationsMoveInstruction) {
+  ShadowViewMutation::PlatformSupportsMoveInstruction = true;
+  testShadowNodeTreeLifeCycle(
+      /* seed */ 0,
+      /* size */ 16,
+      /* repeats */ 512,
+      /* stages */ 32);
+  ShadowViewMutation::PlatformSupportsMoveInstruction = false;
+}
+
+TEST(
+    ShadowTreeLifecycleTest,
+    unstableSmallerTreeMoreIterationsExtensiveFlatteningUnflatteningMoveInstruction) {
+  ShadowViewMutation::PlatformSupportsMoveInstruction = true;
+  testShadowNodeTreeLifeCycleExtensiveFlatteningUnflattening(
+      /* seed */ 1337,
+      /* size */ 32,
+      /* repeats */ 512,
+      /* stages */ 32);
+  ShadowViewMutation::PlatformSupportsMoveInstruction = false;
+}
+
+TEST(ShadowTreeLifecycleTest, stableSmallerTreeMoreIterationsCachedLayers) {
+  CoreFeatures::cacheFlattenedViewLayers = true;
+  testShadowNodeTreeLifeCycle(
+      /* seed */ 0,
+      /* size */ 16,
+      /* repeats */ 512,
+      /* stages */ 32);
+  CoreFeatures::cacheFlattenedViewLayers = false;
+}
+
+TEST(
+    ShadowTreeLifecycleTest,
+    unstableSmallerTreeMoreIterationsExtensiveFlatteningUnflatteningCachedLayers) {
+  CoreFeatures::cacheFlattenedViewLayers = true;
+  testShadowNodeTreeLifeCycleExtensiveFlatteningUnflattening(
+      /* seed */ 1337,
+      /* size */ 32,
+      /* repeats */ 512,
+      /* stages */ 32);
+  CoreFeatures::cacheFlattenedViewLayers = false;
+}
+
 // failing test case found 4-25-2021
 TEST(
     ShadowTreeLifecycleTest,
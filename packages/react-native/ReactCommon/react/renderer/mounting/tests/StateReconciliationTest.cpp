@@ -5,12 +5,14 @@
  * LICENSE file in the root directory of this source tree.
  */
 
+#include <functional>
 #include <memory>
 
 #include <gtest/gtest.h>
 
 #include <react/renderer/componentregistry/ComponentDescriptorProviderRegistry.h>
 #include <react/renderer/components/view/ViewComponentDescriptor.h>
+#include <react/renderer/core/ObsoleteStateRegistry.h>
 #include <react/renderer/core/PropsParserContext.h>
 #include <react/renderer/element/ComponentBuilder.h>
 #include <react/renderer/element/Element.h>
@@ -295,6 +297,250 @@ TEST_P(StateReconciliationTest, testCloneslessStateReconciliationDoesntClone) {
     EXPECT_EQ(scrollViewShadowNode, newlyClonedShadowNode.get());
   }
 }
+
+TEST_P(StateReconciliationTest, testOnlyFamiliesWithObsoleteStateAreVisited) {
+  auto shadowNodeAA = std::shared_ptr<ViewShadowNode>{};
+  auto shadowNodeAB = std::shared_ptr<ViewShadowNode>{};
+  auto shadowNodeABA = std::shared_ptr<ScrollViewShadowNode>{};
+
+  // clang-format off
+  auto element =
+      Element<RootShadowNode>()
+        .surfaceId(12)
+        .children({
+          Element<ViewShadowNode>()
+            .surfaceId(12)
+            .reference(shadowNodeAA),
+          Element<ViewShadowNode>()
+            .surfaceId(12)
+            .reference(shadowNodeAB)
+            .children({
+              Element<ScrollViewShadowNode>()
+                .surfaceId(12)
+                .reference(shadowNodeABA)
+            })
+        });
+  // clang-format on
+
+  ContextContainer contextContainer{};
+
+  auto rootShadowNode1 = builder_.build(element);
+
+  auto& scrollViewComponentDescriptor =
+      shadowNodeABA->getComponentDescriptor();
+  auto& family = shadowNodeABA->getFamily();
+  auto state1 = shadowNodeABA->getState();
+  auto shadowTreeDelegate = DummyShadowTreeDelegate{};
+  ShadowTree shadowTree{
+      SurfaceId{12},
+      LayoutConstraints{},
+      LayoutContext{},
+      shadowTreeDelegate,
+      contextContainer};
+
+  shadowTree.commit(
+      [&](const RootShadowNode& /*oldRootShadowNode*/) {
+        return std::static_pointer_cast<RootShadowNode>(rootShadowNode1);
+      },
+      {true});
+
+  EXPECT_TRUE(ObsoleteStateRegistry::shared().get(SurfaceId{12}).empty());
+
+  // A state update coming from native.
+  auto state2 = scrollViewComponentDescriptor.createState(
+      family, std::make_shared<const ScrollViewState>());
+
+  auto rootShadowNodeClonedFromStateUpdate =
+      rootShadowNode1->cloneTree(family, [&](const ShadowNode& oldShadowNode) {
+        return oldShadowNode.clone(
+            {ShadowNodeFragment::propsPlaceholder(),
+             ShadowNodeFragment::childrenPlaceholder(),
+             state2});
+      });
+
+  shadowTree.commit(
+      [&](const RootShadowNode& /*oldRootShadowNode*/) {
+        return std::static_pointer_cast<RootShadowNode>(
+            rootShadowNodeClonedFromStateUpdate);
+      },
+      {});
+
+  auto entries = ObsoleteStateRegistry::shared().get(SurfaceId{12});
+  ASSERT_EQ(entries.size(), 1);
+  EXPECT_EQ(entries[0].family.get(), &family);
+
+  // React commits a tree that still has the obsolete state.
+  auto newShadowNodeAA = shadowNodeAA->clone({});
+  auto rootShadowNodeClonedFromReact = rootShadowNode1->cloneTree(
+      shadowNodeAA->getFamily(),
+      [&](const ShadowNode& /*oldShadowNode*/) { return newShadowNodeAA; });
+
+  shadowTree.commit(
+      [&](const RootShadowNode& /*oldRootShadowNode*/) {
+        return std::static_pointer_cast<RootShadowNode>(
+            rootShadowNodeClonedFromReact);
+      },
+      {true});
+
+  // The clone-less algorithm can't progress the state of a mounted node.
+  if (!GetParam()) {
+    EXPECT_EQ(findDescendantNode(shadowTree, family)->getState(), state2);
+  } else {
+    EXPECT_EQ(findDescendantNode(shadowTree, family)->getState(), state1);
+  }
+  EXPECT_EQ(
+      findDescendantNode(shadowTree, shadowNodeAA->getFamily()),
+      newShadowNodeAA.get());
+  // React still holds the obsolete state, so the family stays tracked.
+  EXPECT_EQ(ObsoleteStateRegistry::shared().get(SurfaceId{12}).size(), 1);
+
+  // React catches up with the most recent state.
+  auto rootShadowNodeUpToDate = rootShadowNodeClonedFromReact->cloneTree(
+      family,
+      [&](const ShadowNode& oldShadowNode) { return oldShadowNode.clone({}); });
+
+  shadowTree.commit(
+      [&](const RootShadowNode& /*oldRootShadowNode*/) {
+        return std::static_pointer_cast<RootShadowNode>(rootShadowNodeUpToDate);
+      },
+      {true});
+
+  EXPECT_EQ(findDescendantNode(shadowTree, family)->getState(), state2);
+  EXPECT_TRUE(ObsoleteStateRegistry::shared().get(SurfaceId{12}).empty());
+}
+
+TEST_P(StateReconciliationTest, testEntriesStayUntilTheCommitSucceeds) {
+  auto shadowNodeAA = std::shared_ptr<ScrollViewShadowNode>{};
+
+  // clang-format off
+  auto element =
+      Element<RootShadowNode>()
+        .surfaceId(13)
+        .children({
+          Element<ScrollViewShadowNode>()
+            .surfaceId(13)
+            .reference(shadowNodeAA)
+        });
+  // clang-format on
+
+  ContextContainer contextContainer{};
+
+  auto rootShadowNode1 = builder_.build(element);
+
+  auto& family = shadowNodeAA->getFamily();
+  auto shadowTreeDelegate = DummyShadowTreeDelegate{};
+  ShadowTree shadowTree{
+      SurfaceId{13},
+      LayoutConstraints{},
+      LayoutContext{},
+      shadowTreeDelegate,
+      contextContainer};
+
+  shadowTree.commit(
+      [&](const RootShadowNode& /*oldRootShadowNode*/) {
+        return std::static_pointer_cast<RootShadowNode>(rootShadowNode1);
+      },
+      {true});
+
+  // A state update coming from native.
+  auto state2 = shadowNodeAA->getComponentDescriptor().createState(
+      family, std::make_shared<const ScrollViewState>());
+  auto rootShadowNode2 =
+      rootShadowNode1->cloneTree(family, [&](const ShadowNode& oldShadowNode) {
+        return oldShadowNode.clone(
+            {ShadowNodeFragment::propsPlaceholder(),
+             ShadowNodeFragment::childrenPlaceholder(),
+             state2});
+      });
+  shadowTree.commit(
+      [&](const RootShadowNode& /*oldRootShadowNode*/) {
+        return std::static_pointer_cast<RootShadowNode>(rootShadowNode2);
+      },
+      {});
+  ASSERT_EQ(ObsoleteStateRegistry::shared().get(SurfaceId{13}).size(), 1);
+
+  // React catches up with the most recent state, but the commit yields after
+  // state reconciliation.
+  auto rootShadowNodeUpToDate = rootShadowNode2->cloneTree(
+      family,
+      [&](const ShadowNode& oldShadowNode) { return oldShadowNode.clone({}); });
+  auto commit = [&](std::function<bool()> shouldYield) {
+    return shadowTree.commit(
+        [&](const RootShadowNode& /*oldRootShadowNode*/) {
+          return std::static_pointer_cast<RootShadowNode>(
+              rootShadowNodeUpToDate);
+        },
+        {/* .enableStateReconciliation = */ true,
+         /* .mountSynchronously = */ true,
+         /* .shouldYield = */ std::move(shouldYield)});
+  };
+
+  int shouldYieldCalls = 0;
+  EXPECT_EQ(
+      commit([&]() { return ++shouldYieldCalls > 1; }),
+      ShadowTree::CommitStatus::Cancelled);
+  EXPECT_EQ(ObsoleteStateRegistry::shared().get(SurfaceId{13}).size(), 1);
+
+  EXPECT_EQ(commit(nullptr), ShadowTree::CommitStatus::Succeeded);
+  EXPECT_TRUE(ObsoleteStateRegistry::shared().get(SurfaceId{13}).empty());
+}
+
+TEST_P(StateReconciliationTest, testEntriesAreRemovedWithTheSurface) {
+  auto shadowNodeAA = std::shared_ptr<ScrollViewShadowNode>{};
+
+  // clang-format off
+  auto element =
+      Element<RootShadowNode>()
+        .surfaceId(14)
+        .children({
+          Element<ScrollViewShadowNode>()
+            .surfaceId(14)
+            .reference(shadowNodeAA)
+        });
+  // clang-format on
+
+  ContextContainer contextContainer{};
+
+  auto rootShadowNode1 = builder_.build(element);
+
+  auto& family = shadowNodeAA->getFamily();
+  auto shadowTreeDelegate = DummyShadowTreeDelegate{};
+  auto shadowTree = std::make_unique<ShadowTree>(
+      SurfaceId{14},
+      LayoutConstraints{},
+      LayoutContext{},
+      shadowTreeDelegate,
+      contextContainer);
+
+  shadowTree->commit(
+      [&](const RootShadowNode& /*oldRootShadowNode*/) {
+        return std::static_pointer_cast<RootShadowNode>(rootShadowNode1);
+      },
+      {true});
+
+  // A state update coming from native.
+  auto state2 = shadowNodeAA->getComponentDescriptor().createState(
+      family, std::make_shared<const ScrollViewState>());
+  auto rootShadowNode2 =
+      rootShadowNode1->cloneTree(family, [&](const ShadowNode& oldShadowNode) {
+        return oldShadowNode.clone(
+            {ShadowNodeFragment::propsPlaceholder(),
+             ShadowNodeFragment::childrenPlaceholder(),
+             state2});
+      });
+  shadowTree->commit(
+      [&](const RootShadowNode& /*oldRootShadowNode*/) {
+        return std::static_pointer_cast<RootShadowNode>(rootShadowNode2);
+      },
+      {});
+  ASSERT_EQ(ObsoleteStateRegistry::shared().get(SurfaceId{14}).size(), 1);
+
+  // The family is still alive, but the surface is stopped.
+  shadowTree.reset();
+
+  EXPECT_TRUE(ObsoleteStateRegistry::shared().get(SurfaceId{14}).empty());
+}
+
 INSTANTIATE_TEST_SUITE_P(
     StateReconciliationTestInstantiation,
     StateReconciliationTest,
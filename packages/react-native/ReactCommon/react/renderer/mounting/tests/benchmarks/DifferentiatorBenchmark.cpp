@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <react/renderer/components/root/RootComponentDescriptor.h>
+#include <react/renderer/components/view/ViewComponentDescriptor.h>
+#include <react/renderer/element/ComponentBuilder.h>
+#include <react/renderer/element/Element.h>
+#include <react/renderer/element/testUtils.h>
+#include <react/renderer/mounting/Differentiator.h>
+#include <react/utils/CoreFeatures.h>
+#include <memory>
+#include <vector>
+
+namespace facebook::react {
+
+static Element<ViewShadowNode> concreteView() {
+  return Element<ViewShadowNode>().props([] {
+    auto props = std::make_shared<ViewShadowNodeProps>();
+    props->backgroundColor = blackColor();
+    return props;
+  });
+}
+
+/*
+ * Builds a tree where most of the hierarchy is flattened: the root layer
+ * consists of 100 layout-only containers with 10 cards each, and every card
+ * flattens two layout-only wrappers with 5 leaves each.
+ */
+static std::shared_ptr<RootShadowNode> buildFlatteningHeavyTree(
+    ComponentBuilder& builder,
+    std::vector<std::shared_ptr<ViewShadowNode>>& leaves) {
+  // `reference` stores the address, so the vector must not reallocate.
+  leaves.reserve(100 * 10 * 2 * 5);
+
+  auto containers = std::vector<ElementFragment>{};
+  for (int containerIndex = 0; containerIndex < 100; containerIndex++) {
+    auto cards = std::vector<ElementFragment>{};
+    for (int cardIndex = 0; cardIndex < 10; cardIndex++) {
+      auto wrappers = std::vector<ElementFragment>{};
+      for (int wrapperIndex = 0; wrapperIndex < 2; wrapperIndex++) {
+        auto wrapperLeaves = std::vector<ElementFragment>{};
+        for (int leafIndex = 0; leafIndex < 5; leafIndex++) {
+          leaves.emplace_back();
+          wrapperLeaves.push_back(concreteView().reference(leaves.back()));
+        }
+        wrappers.push_back(
+            Element<ViewShadowNode>().children(std::move(wrapperLeaves)));
+      }
+      cards.push_back(concreteView().children(std::move(wrappers)));
+    }
+    containers.push_back(Element<ViewShadowNode>().children(std::move(cards)));
+  }
+
+  auto rootShadowNode = builder.build(
+      Element<RootShadowNode>().children(std::move(containers)));
+  rootShadowNode->layoutIfNeeded();
+  rootShadowNode->sealRecursive();
+  return rootShadowNode;
+}
+
+/*
+ * Diffs a sequence of revisions which update the props of one leaf each,
+ * the way consecutive commits of a surface are diffed.
+ */
+static void diffRevisions(benchmark::State& state, bool cacheLayers) {
+  CoreFeatures::cacheFlattenedViewLayers = cacheLayers;
+
+  auto builder = simpleComponentBuilder();
+  auto leaves = std::vector<std::shared_ptr<ViewShadowNode>>{};
+  auto rootShadowNode = buildFlatteningHeavyTree(builder, leaves);
+  size_t revision = 0;
+
+  // The initial render slices (and caches) every layer of the tree.
+  auto viewLayerCache = ViewLayerCache{};
+  auto emptyRootShadowNode = builder.build(Element<RootShadowNode>());
+  calculateShadowViewMutations(
+      *emptyRootShadowNode, *rootShadowNode, &viewLayerCache);
+
+  for (auto _ : state) {
+    state.PauseTiming();
+    const auto& leaf = leaves[(revision * 7919) % leaves.size()];
+    auto nextRootShadowNode =
+        std::static_pointer_cast<RootShadowNode>(rootShadowNode->cloneTree(
+            leaf->getFamily(), [&](const ShadowNode& oldShadowNode) {
+              auto props = std::make_shared<ViewShadowNodeProps>();
+              props->backgroundColor =
+                  revision % 2 == 0 ? whiteColor() : blackColor();
+              return oldShadowNode.clone(ShadowNodeFragment{props});
+            }));
+    nextRootShadowNode->layoutIfNeeded();
+    nextRootShadowNode->sealRecursive();
+    revision++;
+    state.ResumeTiming();
+
+    benchmark::DoNotOptimize(calculateShadowViewMutations(
+        *rootShadowNode, *nextRootShadowNode, &viewLayerCache));
+
+    state.PauseTiming();
+    rootShadowNode = nextRootShadowNode;
+    state.ResumeTiming();
+  }
+
+  CoreFeatures::cacheFlattenedViewLayers = false;
+}
+
+static void diffFlatteningHeavyTree(benchmark::State& state) {
+  diffRevisions(state, false);
+}
+BENCHMARK(diffFlatteningHeavyTree);
+
+static void diffFlatteningHeavyTreeWithCachedLayers(benchmark::State& state) {
+  diffRevisions(state, true);
+}
+BENCHMARK(diffFlatteningHeavyTreeWithCachedLayers);
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
@@ -84,4 +84,9 @@ void RuntimeScheduler::scheduleRenderingUpdate(
       std::move(renderingUpdate));
 }
 
+SchedulerLaneStats RuntimeScheduler::getLaneStats(
+    SchedulerLane lane) const noexcept {
+  return runtimeSchedulerImpl_->getLaneStats(lane);
+}
+
 } // namespace facebook::react
@@ -9,6 +9,7 @@
 
 #include <ReactCommon/RuntimeExecutor.h>
 #include <react/renderer/runtimescheduler/RuntimeSchedulerClock.h>
+#include <react/renderer/runtimescheduler/SchedulerLane.h>
 #include <react/renderer/runtimescheduler/Task.h>
 
 namespace facebook::react {
@@ -35,6 +36,7 @@ class RuntimeSchedulerBase {
   virtual void callExpiredTasks(jsi::Runtime& runtime) = 0;
   virtual void scheduleRenderingUpdate(
       RuntimeSchedulerRenderingUpdate&& renderingUpdate) = 0;
+  virtual SchedulerLaneStats getLaneStats(SchedulerLane lane) const noexcept = 0;
 };
 
 // This is a proxy for RuntimeScheduler implementation, which will be selected
@@ -127,6 +129,14 @@ class RuntimeScheduler final : RuntimeSchedulerBase {
   void scheduleRenderingUpdate(
       RuntimeSchedulerRenderingUpdate&& renderingUpdate) override;
 
+  /*
+   * Returns how long the work executed in the given lane waited for the
+   * runtime.
+   *
+   * Can be called from any thread.
+   */
+  SchedulerLaneStats getLaneStats(SchedulerLane lane) const noexcept override;
+
  private:
   // Actual implementation, stored as a unique pointer to simplify memory
   // management.
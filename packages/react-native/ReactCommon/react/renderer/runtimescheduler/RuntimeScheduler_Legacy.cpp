@@ -45,9 +45,11 @@ std::shared_ptr<Task> RuntimeScheduler_Legacy::scheduleTask(
       "callbackType",
       "jsi::Function");
 
-  auto expirationTime = now_() + timeoutForSchedulerPriority(priority);
+  auto currentTime = now_();
+  auto expirationTime = currentTime + timeoutForSchedulerPriority(priority);
   auto task =
       std::make_shared<Task>(priority, std::move(callback), expirationTime);
+  task->scheduledTime = currentTime;
   taskQueue_.push(task);
 
   scheduleWorkLoopIfNecessary();
@@ -65,9 +67,11 @@ std::shared_ptr<Task> RuntimeScheduler_Legacy::scheduleTask(
       "callbackType",
       "RawCallback");
 
-  auto expirationTime = now_() + timeoutForSchedulerPriority(priority);
+  auto currentTime = now_();
+  auto expirationTime = currentTime + timeoutForSchedulerPriority(priority);
   auto task =
       std::make_shared<Task>(priority, std::move(callback), expirationTime);
+  task->scheduledTime = currentTime;
   taskQueue_.push(task);
 
   scheduleWorkLoopIfNecessary();
@@ -97,13 +101,17 @@ void RuntimeScheduler_Legacy::executeNowOnTheSameThread(
   SystraceSection s("RuntimeScheduler::executeNowOnTheSameThread");
 
   runtimeAccessRequests_ += 1;
+  auto requestTime = now_();
   executeSynchronouslyOnSameThread_CAN_DEADLOCK(
       runtimeExecutor_,
-      [this, callback = std::move(callback)](jsi::Runtime& runtime) {
+      [this, requestTime, callback = std::move(callback)](
+          jsi::Runtime& runtime) {
         SystraceSection s2(
             "RuntimeScheduler::executeNowOnTheSameThread callback");
 
         runtimeAccessRequests_ -= 1;
+        laneStats_.record(
+            SchedulerLane::SynchronousFromUI, now_() - requestTime);
         callback(runtime);
       });
 
@@ -127,7 +135,9 @@ void RuntimeScheduler_Legacy::callExpiredTasks(jsi::Runtime& runtime) {
         break;
       }
 
+      recordTaskWaitTime(*topPriorityTask, now);
       executeTask(runtime, topPriorityTask, didUserCallbackTimeout);
+      rescheduleContinuation(*topPriorityTask);
     }
   } catch (jsi::JSError& error) {
     handleFatalError(runtime, error);
@@ -145,6 +155,11 @@ void RuntimeScheduler_Legacy::scheduleRenderingUpdate(
   }
 }
 
+SchedulerLaneStats RuntimeScheduler_Legacy::getLaneStats(
+    SchedulerLane lane) const noexcept {
+  return laneStats_.getStats(lane);
+}
+
 #pragma mark - Private
 
 void RuntimeScheduler_Legacy::scheduleWorkLoopIfNecessary() {
@@ -173,7 +188,9 @@ void RuntimeScheduler_Legacy::startWorkLoop(jsi::Runtime& runtime) {
         break;
       }
 
+      recordTaskWaitTime(*topPriorityTask, now);
       executeTask(runtime, topPriorityTask, didUserCallbackTimeout);
+      rescheduleContinuation(*topPriorityTask);
     }
   } catch (jsi::JSError& error) {
     handleFatalError(runtime, error);
@@ -206,4 +223,22 @@ void RuntimeScheduler_Legacy::executeTask(
   }
 }
 
+void RuntimeScheduler_Legacy::recordTaskWaitTime(
+    const Task& task,
+    RuntimeSchedulerTimePoint currentTime) noexcept {
+  // Cancelled tasks are only removed from the queue.
+  if (!task.callback) {
+    return;
+  }
+  laneStats_.record(
+      schedulerLaneForPriority(task.priority),
+      currentTime - task.scheduledTime);
+}
+
+void RuntimeScheduler_Legacy::rescheduleContinuation(Task& task) const {
+  if (task.callback) {
+    task.scheduledTime = now_();
+  }
+}
+
 } // namespace facebook::react
@@ -39,9 +39,11 @@ std::shared_ptr<Task> RuntimeScheduler_Modern::scheduleTask(
       "callbackType",
       "jsi::Function");
 
-  auto expirationTime = now_() + timeoutForSchedulerPriority(priority);
+  auto currentTime = now_();
+  auto expirationTime = currentTime + timeoutForSchedulerPriority(priority);
   auto task =
       std::make_shared<Task>(priority, std::move(callback), expirationTime);
+  task->scheduledTime = currentTime;
 
   scheduleTask(task);
 
@@ -58,9 +60,11 @@ std::shared_ptr<Task> RuntimeScheduler_Modern::scheduleTask(
       "callbackType",
       "RawCallback");
 
-  auto expirationTime = now_() + timeoutForSchedulerPriority(priority);
+  auto currentTime = now_();
+  auto expirationTime = currentTime + timeoutForSchedulerPriority(priority);
   auto task =
       std::make_shared<Task>(priority, std::move(callback), expirationTime);
+  task->scheduledTime = currentTime;
 
   scheduleTask(task);
 
@@ -92,16 +96,20 @@ void RuntimeScheduler_Modern::executeNowOnTheSameThread(
   SystraceSection s("RuntimeScheduler::executeNowOnTheSameThread");
 
   syncTaskRequests_++;
+  auto requestTime = now_();
 
   executeSynchronouslyOnSameThread_CAN_DEADLOCK(
       runtimeExecutor_,
-      [this, callback = std::move(callback)](jsi::Runtime& runtime) mutable {
+      [this, requestTime, callback = std::move(callback)](
+          jsi::Runtime& runtime) mutable {
         SystraceSection s2(
             "RuntimeScheduler::executeNowOnTheSameThread callback");
 
         syncTaskRequests_--;
 
         auto currentTime = now_();
+        laneStats_.record(
+            SchedulerLane::SynchronousFromUI, currentTime - requestTime);
         auto priority = SchedulerPriority::ImmediatePriority;
         auto expirationTime =
             currentTime + timeoutForSchedulerPriority(priority);
@@ -153,6 +161,11 @@ void RuntimeScheduler_Modern::scheduleRenderingUpdate(
   }
 }
 
+SchedulerLaneStats RuntimeScheduler_Modern::getLaneStats(
+    SchedulerLane lane) const noexcept {
+  return laneStats_.getStats(lane);
+}
+
 #pragma mark - Private
 
 void RuntimeScheduler_Modern::scheduleTask(std::shared_ptr<Task> task) {
@@ -201,7 +214,9 @@ void RuntimeScheduler_Modern::startWorkLoop(
         break;
       }
 
+      recordTaskWaitTime(*topPriorityTask, currentTime);
       executeTask(runtime, topPriorityTask, currentTime);
+      rescheduleContinuation(*topPriorityTask);
     }
   } catch (jsi::JSError& error) {
     handleFatalError(runtime, error);
@@ -266,6 +281,24 @@ void RuntimeScheduler_Modern::executeTask(
   }
 }
 
+void RuntimeScheduler_Modern::recordTaskWaitTime(
+    const Task& task,
+    RuntimeSchedulerTimePoint currentTime) noexcept {
+  // Cancelled tasks are only removed from the queue.
+  if (!task.callback) {
+    return;
+  }
+  laneStats_.record(
+      schedulerLaneForPriority(task.priority),
+      currentTime - task.scheduledTime);
+}
+
+void RuntimeScheduler_Modern::rescheduleContinuation(Task& task) const {
+  if (task.callback) {
+    task.scheduledTime = now_();
+  }
+}
+
 /**
  * This is partially equivalent to the "Update the rendering" step in the Web
  * event loop. See
@@ -122,6 +122,14 @@ class RuntimeScheduler_Modern final : public RuntimeSchedulerBase {
   void scheduleRenderingUpdate(
       RuntimeSchedulerRenderingUpdate&& renderingUpdate) override;
 
+  /*
+   * Returns how long the work executed in the given lane waited for the
+   * runtime.
+   *
+   * Can be called from any thread.
+   */
+  SchedulerLaneStats getLaneStats(SchedulerLane lane) const noexcept override;
+
  private:
   std::atomic<uint_fast8_t> syncTaskRequests_{0};
 
@@ -177,6 +185,21 @@ class RuntimeScheduler_Modern final : public RuntimeSchedulerBase {
    */
   std::function<RuntimeSchedulerTimePoint()> now_;
 
+  SchedulerLaneStatsRecorder laneStats_;
+
+  /*
+   * Records the wait time of a task that is about to be executed by the work
+   * loop.
+   */
+  void recordTaskWaitTime(
+      const Task& task,
+      RuntimeSchedulerTimePoint currentTime) noexcept;
+
+  /*
+   * Restarts the wait of a task that returned a continuation.
+   */
+  void rescheduleContinuation(Task& task) const;
+
   /*
    * Flag indicating if callback on JavaScript queue has been
    * scheduled.
@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "SchedulerLane.h"
+
+#include <algorithm>
+
+namespace facebook::react {
+
+SchedulerLane schedulerLaneForPriority(SchedulerPriority priority) noexcept {
+  switch (priority) {
+    case SchedulerPriority::ImmediatePriority:
+    case SchedulerPriority::UserBlockingPriority:
+      return SchedulerLane::DiscreteEvent;
+    case SchedulerPriority::NormalPriority:
+    case SchedulerPriority::LowPriority:
+      return SchedulerLane::Default;
+    case SchedulerPriority::IdlePriority:
+      return SchedulerLane::Idle;
+  }
+  return SchedulerLane::Default;
+}
+
+RuntimeSchedulerDuration SchedulerLaneStats::averageWaitTime() const noexcept {
+  if (executedTasks == 0) {
+    return RuntimeSchedulerDuration{0};
+  }
+  return totalWaitTime / executedTasks;
+}
+
+void SchedulerLaneStatsRecorder::record(
+    SchedulerLane lane,
+    RuntimeSchedulerDuration waitTime) noexcept {
+  // A clock that is not monotonic across threads must not produce negative
+  // waits.
+  waitTime = std::max(waitTime, RuntimeSchedulerDuration{0});
+
+  std::scoped_lock lock(mutex_);
+  auto& stats = stats_[static_cast<size_t>(lane)];
+  stats.executedTasks++;
+  stats.totalWaitTime += waitTime;
+  stats.maxWaitTime = std::max(stats.maxWaitTime, waitTime);
+}
+
+SchedulerLaneStats SchedulerLaneStatsRecorder::getStats(
+    SchedulerLane lane) const noexcept {
+  std::scoped_lock lock(mutex_);
+  return stats_[static_cast<size_t>(lane)];
+}
+
+} // namespace facebook::react
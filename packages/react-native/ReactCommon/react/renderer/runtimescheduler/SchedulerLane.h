@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <ReactCommon/SchedulerPriority.h>
+#include <react/renderer/runtimescheduler/RuntimeSchedulerClock.h>
+#include <array>
+#include <mutex>
+
+namespace facebook::react {
+
+/*
+ * Groups the work done by `RuntimeScheduler` by where it comes from.
+ * Synchronous access requested by the host platform (e.g. from the UI thread)
+ * is served before any queued task; queued tasks map to a lane by their
+ * priority.
+ */
+enum class SchedulerLane : uint8_t {
+  SynchronousFromUI = 0,
+  DiscreteEvent = 1,
+  Default = 2,
+  Idle = 3,
+};
+
+static constexpr size_t kSchedulerLaneCount = 4;
+
+SchedulerLane schedulerLaneForPriority(SchedulerPriority priority) noexcept;
+
+/*
+ * Wait times of the work executed in a lane: from the moment the work was
+ * scheduled (or synchronous access was requested) until it started executing.
+ */
+struct SchedulerLaneStats {
+  size_t executedTasks{0};
+  RuntimeSchedulerDuration totalWaitTime{0};
+  RuntimeSchedulerDuration maxWaitTime{0};
+
+  RuntimeSchedulerDuration averageWaitTime() const noexcept;
+};
+
+/*
+ * Accumulates `SchedulerLaneStats` for all lanes.
+ * The class is thread-safe.
+ */
+class SchedulerLaneStatsRecorder final {
+ public:
+  void record(SchedulerLane lane, RuntimeSchedulerDuration waitTime) noexcept;
+
+  SchedulerLaneStats getStats(SchedulerLane lane) const noexcept;
+
+ private:
+  mutable std::mutex mutex_;
+  std::array<SchedulerLaneStats, kSchedulerLaneCount> stats_{};
+};
+
+} // namespace facebook::react
@@ -41,6 +41,8 @@ struct Task final : public jsi::NativeState {
   SchedulerPriority priority;
   std::optional<std::variant<jsi::Function, RawCallback>> callback;
   RuntimeSchedulerClock::time_point expirationTime;
+  // When the task was scheduled, or when its last continuation was returned.
+  RuntimeSchedulerClock::time_point scheduledTime{};
 
   jsi::Value execute(jsi::Runtime& runtime, bool didUserCallbackTimeout);
 };
@@ -795,6 +795,40 @@ TEST_P(RuntimeSchedulerTest, basicSameThreadExecution) {
   EXPECT_TRUE(didRunSynchronousTask);
 }
 
+TEST_P(RuntimeSchedulerTest, laneStatsRecordWaitTimes) {
+  runtimeScheduler_->scheduleTask(
+      SchedulerPriority::NormalPriority, [](jsi::Runtime& /*unused*/) {});
+  stubClock_->advanceTimeBy(10ms);
+  runtimeScheduler_->scheduleTask(
+      SchedulerPriority::IdlePriority, [](jsi::Runtime& /*unused*/) {});
+  stubClock_->advanceTimeBy(5ms);
+
+  stubQueue_->tick();
+
+  auto defaultStats = runtimeScheduler_->getLaneStats(SchedulerLane::Default);
+  EXPECT_EQ(defaultStats.executedTasks, 1);
+  EXPECT_EQ(defaultStats.maxWaitTime, 15ms);
+  auto idleStats = runtimeScheduler_->getLaneStats(SchedulerLane::Idle);
+  EXPECT_EQ(idleStats.executedTasks, 1);
+  EXPECT_EQ(idleStats.maxWaitTime, 5ms);
+
+  std::thread t1([this]() {
+    runtimeScheduler_->executeNowOnTheSameThread(
+        [](jsi::Runtime& /*rt*/) {});
+  });
+  stubQueue_->waitForTask();
+  stubQueue_->tick();
+  t1.join();
+
+  auto syncStats =
+      runtimeScheduler_->getLaneStats(SchedulerLane::SynchronousFromUI);
+  EXPECT_EQ(syncStats.executedTasks, 1);
+  EXPECT_EQ(
+      runtimeScheduler_->getLaneStats(SchedulerLane::DiscreteEvent)
+          .executedTasks,
+      0);
+}
+
 TEST_P(RuntimeSchedulerTest, sameThreadTaskCreatesImmediatePriorityTask) {
   bool didRunSynchronousTask = false;
   bool didRunSubsequentTask = false;
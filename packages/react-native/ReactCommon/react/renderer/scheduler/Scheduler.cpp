@@ -7,6 +7,9 @@
 
 #include "Scheduler.h"
 
+#include <stdexcept>
+#include <string>
+
 #include <glog/logging.h>
 #include <jsi/jsi.h>
 
@@ -28,33 +31,25 @@
 
 namespace facebook::react {
 
-Scheduler::Scheduler(
-    const SchedulerToolbox& schedulerToolbox,
-    UIManagerAnimationDelegate* animationDelegate,
-    SchedulerDelegate* delegate) {
-  runtimeExecutor_ = schedulerToolbox.runtimeExecutor;
-  contextContainer_ = schedulerToolbox.contextContainer;
-
-  reactNativeConfig_ =
-      contextContainer_->at<std::shared_ptr<const ReactNativeConfig>>(
-          "ReactNativeConfig");
-
+/*
+ * Creates an `EventDispatcher` (inside a container, see `eventDispatcher_`)
+ * delivering events to the `UIManagerBinding` of the runtime its event beats
+ * run on.
+ */
+static std::shared_ptr<std::optional<const EventDispatcher>>
+createEventDispatcher(
+    const std::shared_ptr<UIManager>& uiManager,
+    RuntimeScheduler* runtimeScheduler,
+    const EventBeat::Factory& synchronousEventBeatFactory,
+    const EventBeat::Factory& asynchronousEventBeatFactory) {
   // Creating a container for future `EventDispatcher` instance.
-  eventDispatcher_ = std::make_shared<std::optional<const EventDispatcher>>();
+  auto eventDispatcher =
+      std::make_shared<std::optional<const EventDispatcher>>();
 
-  auto uiManager = std::make_shared<UIManager>(
-      runtimeExecutor_, schedulerToolbox.backgroundExecutor, contextContainer_);
   auto eventOwnerBox = std::make_shared<EventBeat::OwnerBox>();
-  eventOwnerBox->owner = eventDispatcher_;
+  eventOwnerBox->owner = eventDispatcher;
 
-  auto weakRuntimeScheduler =
-      contextContainer_->find<std::weak_ptr<RuntimeScheduler>>(
-          "RuntimeScheduler");
-  auto runtimeScheduler = weakRuntimeScheduler.has_value()
-      ? weakRuntimeScheduler.value().lock()
-      : nullptr;
-
-  auto eventPipe = [uiManager, runtimeScheduler = runtimeScheduler.get()](
+  auto eventPipe = [uiManager](
                        jsi::Runtime& runtime,
                        const EventTarget* eventTarget,
                        const std::string& type,
@@ -68,12 +63,11 @@ Scheduler::Scheduler(
         runtime);
   };
 
-  auto eventPipeConclusion =
-      [runtimeScheduler = runtimeScheduler.get()](jsi::Runtime& runtime) {
-        if (runtimeScheduler != nullptr) {
-          runtimeScheduler->callExpiredTasks(runtime);
-        }
-      };
+  auto eventPipeConclusion = [runtimeScheduler](jsi::Runtime& runtime) {
+    if (runtimeScheduler != nullptr) {
+      runtimeScheduler->callExpiredTasks(runtime);
+    }
+  };
 
   auto statePipe = [uiManager](const StateUpdate& stateUpdate) {
     uiManager->updateState(stateUpdate);
@@ -81,12 +75,42 @@ Scheduler::Scheduler(
 
   // Creating an `EventDispatcher` instance inside the already allocated
   // container (inside the optional).
-  eventDispatcher_->emplace(
+  eventDispatcher->emplace(
       EventQueueProcessor(eventPipe, eventPipeConclusion, statePipe),
-      schedulerToolbox.synchronousEventBeatFactory,
-      schedulerToolbox.asynchronousEventBeatFactory,
+      synchronousEventBeatFactory,
+      asynchronousEventBeatFactory,
       eventOwnerBox);
 
+  return eventDispatcher;
+}
+
+Scheduler::Scheduler(
+    const SchedulerToolbox& schedulerToolbox,
+    UIManagerAnimationDelegate* animationDelegate,
+    SchedulerDelegate* delegate) {
+  runtimeExecutor_ = schedulerToolbox.runtimeExecutor;
+  contextContainer_ = schedulerToolbox.contextContainer;
+
+  reactNativeConfig_ =
+      contextContainer_->at<std::shared_ptr<const ReactNativeConfig>>(
+          "ReactNativeConfig");
+
+  auto uiManager = std::make_shared<UIManager>(
+      runtimeExecutor_, schedulerToolbox.backgroundExecutor, contextContainer_);
+
+  auto weakRuntimeScheduler =
+      contextContainer_->find<std::weak_ptr<RuntimeScheduler>>(
+          "RuntimeScheduler");
+  auto runtimeScheduler = weakRuntimeScheduler.has_value()
+      ? weakRuntimeScheduler.value().lock()
+      : nullptr;
+
+  eventDispatcher_ = createEventDispatcher(
+      uiManager,
+      runtimeScheduler.get(),
+      schedulerToolbox.synchronousEventBeatFactory,
+      schedulerToolbox.asynchronousEventBeatFactory);
+
   // Casting to `std::shared_ptr<EventDispatcher const>`.
   auto eventDispatcher =
       EventDispatcher::Shared{eventDispatcher_, &eventDispatcher_->value()};
@@ -143,6 +167,15 @@ Scheduler::Scheduler(
 
   CoreFeatures::enableReportEventPaintTime = reactNativeConfig_->getBool(
       "rn_responsiveness_performance:enable_paint_time_reporting");
+
+  CoreFeatures::enableDeferredRevisionDestruction = reactNativeConfig_->getBool(
+      "react_fabric:enable_deferred_revision_destruction");
+
+  CoreFeatures::cacheFlattenedViewLayers = reactNativeConfig_->getBool(
+      "react_fabric:cache_flattened_view_layers");
+
+  CoreFeatures::cacheParsedProps =
+      reactNativeConfig_->getBool("react_fabric:cache_parsed_props");
 }
 
 Scheduler::~Scheduler() {
@@ -240,6 +273,60 @@ InspectorData Scheduler::getInspectorDataForInstance(
 void Scheduler::unregisterSurface(
     const SurfaceHandler& surfaceHandler) const noexcept {
   surfaceHandler.setUIManager(nullptr);
+  uiManager_->removeSurfaceRuntime(surfaceHandler.getSurfaceId());
+}
+
+void Scheduler::registerSurface(
+    const SurfaceHandler& surfaceHandler,
+    RuntimeId runtimeId) const {
+  {
+    std::scoped_lock lock(runtimesMutex_);
+    auto it = runtimes_.find(runtimeId);
+    if (it == runtimes_.end()) {
+      throw std::invalid_argument(
+          "Surface " + std::to_string(surfaceHandler.getSurfaceId()) +
+          " registered with unknown runtime " + std::to_string(runtimeId) +
+          ".");
+    }
+    uiManager_->setSurfaceRuntime(
+        surfaceHandler.getSurfaceId(),
+        it->second.runtimeExecutor,
+        EventDispatcher::Shared{
+            it->second.eventDispatcher, &it->second.eventDispatcher->value()});
+  }
+  registerSurface(surfaceHandler);
+}
+
+#pragma mark - Runtime Management
+
+Scheduler::RuntimeId Scheduler::registerRuntime(
+    const SchedulerRuntimeToolbox& runtimeToolbox) {
+  // Events of the runtime are dispatched on its own beats. The
+  // `RuntimeScheduler` of the context container belongs to the main runtime,
+  // so there are no expired tasks to flush after them.
+  auto eventDispatcher = createEventDispatcher(
+      uiManager_,
+      nullptr,
+      runtimeToolbox.synchronousEventBeatFactory,
+      runtimeToolbox.asynchronousEventBeatFactory);
+
+  runtimeToolbox.runtimeExecutor(
+      [uiManager = uiManager_](jsi::Runtime& runtime) {
+        UIManagerBinding::createAndInstallIfNeeded(runtime, uiManager);
+      });
+
+  std::scoped_lock lock(runtimesMutex_);
+  auto runtimeId = nextRuntimeId_++;
+  runtimes_.emplace(
+      runtimeId,
+      RegisteredRuntime{
+          runtimeToolbox.runtimeExecutor, std::move(eventDispatcher)});
+  return runtimeId;
+}
+
+void Scheduler::unregisterRuntime(RuntimeId runtimeId) {
+  std::scoped_lock lock(runtimesMutex_);
+  runtimes_.erase(runtimeId);
 }
 
 const ComponentDescriptor*
@@ -279,7 +366,11 @@ void Scheduler::uiManagerDidFinishTransaction(
     auto runtimeScheduler = weakRuntimeScheduler.has_value()
         ? weakRuntimeScheduler.value().lock()
         : nullptr;
-    if (runtimeScheduler && !mountSynchronously) {
+    // Surfaces of additional runtimes are mounted as soon as they are
+    // committed: the `RuntimeScheduler` only knows about the main runtime.
+    if (runtimeScheduler && !mountSynchronously &&
+        !uiManager_->getSurfaceEventDispatcher(
+            mountingCoordinator->getSurfaceId())) {
       runtimeScheduler->scheduleRenderingUpdate(
           [delegate = delegate_,
            mountingCoordinator = std::move(mountingCoordinator)]() {
@@ -9,6 +9,7 @@
 
 #include <memory>
 #include <mutex>
+#include <unordered_map>
 
 #include <ReactCommon/RuntimeExecutor.h>
 #include <react/config/ReactNativeConfig.h>
@@ -35,6 +36,11 @@ namespace facebook::react {
  */
 class Scheduler final : public UIManagerDelegate {
  public:
+  /*
+   * Identifies a runtime registered with `registerRuntime`.
+   */
+  using RuntimeId = int32_t;
+
   Scheduler(
       const SchedulerToolbox& schedulerToolbox,
       UIManagerAnimationDelegate* animationDelegate,
@@ -51,6 +57,31 @@ class Scheduler final : public UIManagerDelegate {
   void registerSurface(const SurfaceHandler& surfaceHandler) const noexcept;
   void unregisterSurface(const SurfaceHandler& surfaceHandler) const noexcept;
 
+  /*
+   * Registers a `SurfaceHandler` object rendered by an additional runtime
+   * (see `registerRuntime`) instead of the one of the `SchedulerToolbox`.
+   * The surface must be unregistered with `unregisterSurface`.
+   * Throws `std::invalid_argument` if the runtime is not registered.
+   */
+  void registerSurface(
+      const SurfaceHandler& surfaceHandler,
+      RuntimeId runtimeId) const;
+
+#pragma mark - Runtime Management
+
+  /*
+   * Registers and unregisters an additional JavaScript runtime rendering
+   * surfaces with this `Scheduler`.
+   * Surfaces of all runtimes share the `UIManager`, its component registry and
+   * the mounting pipeline (and so the delegate, which must handle transactions
+   * coming from several JavaScript threads), while each runtime renders its
+   * surfaces and handles their events on its own thread. Transactions of a
+   * surface are still mounted in order.
+   * All surfaces of a runtime must be unregistered before the runtime.
+   */
+  RuntimeId registerRuntime(const SchedulerRuntimeToolbox& runtimeToolbox);
+  void unregisterRuntime(RuntimeId runtimeId);
+
   InspectorData getInspectorDataForInstance(
       const EventEmitter& eventEmitter) const noexcept;
 
@@ -131,6 +162,19 @@ class Scheduler final : public UIManagerDelegate {
    */
   std::shared_ptr<std::optional<const EventDispatcher>> eventDispatcher_;
 
+  /*
+   * Runtimes registered with `registerRuntime`, and the event dispatchers of
+   * their surfaces.
+   */
+  struct RegisteredRuntime {
+    RuntimeExecutor runtimeExecutor;
+    std::shared_ptr<std::optional<const EventDispatcher>> eventDispatcher;
+  };
+
+  mutable std::mutex runtimesMutex_;
+  std::unordered_map<RuntimeId, RegisteredRuntime> runtimes_;
+  RuntimeId nextRuntimeId_{1};
+
   /**
    * Hold onto ContextContainer. See SchedulerToolbox.
    * Must not be nullptr.
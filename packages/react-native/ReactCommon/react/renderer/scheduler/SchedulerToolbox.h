@@ -77,4 +77,23 @@ struct SchedulerToolbox final {
   std::vector<std::shared_ptr<UIManagerCommitHook>> commitHooks;
 };
 
+/*
+ * Contains the dependencies of an additional JavaScript runtime rendering
+ * surfaces with an existing `Scheduler`. See `Scheduler::registerRuntime`.
+ * Copyable.
+ */
+struct SchedulerRuntimeToolbox final {
+  /*
+   * Represents the runtime and its execution queue.
+   * Executes lambdas after the runtime's bundle has loaded.
+   */
+  RuntimeExecutor runtimeExecutor;
+
+  /*
+   * Asynchronous & synchronous event beats of the runtime.
+   */
+  EventBeat::Factory asynchronousEventBeatFactory;
+  EventBeat::Factory synchronousEventBeatFactory;
+};
+
 } // namespace facebook::react
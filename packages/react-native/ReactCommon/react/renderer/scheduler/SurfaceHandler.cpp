@@ -77,7 +77,8 @@ void SurfaceHandler::start() const noexcept {
       parameters.layoutConstraints,
       parameters.layoutContext,
       *link_.uiManager,
-      *parameters.contextContainer);
+      *parameters.contextContainer,
+      link_.uiManager->getSurfaceEventDispatcher(parameters.surfaceId));
 
   link_.shadowTree = shadowTree.get();
 
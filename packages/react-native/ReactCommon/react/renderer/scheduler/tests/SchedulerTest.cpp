@@ -0,0 +1,224 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <react/config/ReactNativeConfig.h>
+#include <react/renderer/componentregistry/ComponentDescriptorProviderRegistry.h>
+#include <react/renderer/components/root/RootComponentDescriptor.h>
+#include <react/renderer/components/view/ViewComponentDescriptor.h>
+#include <react/renderer/scheduler/Scheduler.h>
+#include <react/renderer/scheduler/SurfaceHandler.h>
+#include <react/renderer/uimanager/UIManager.h>
+
+using namespace facebook::react;
+
+namespace {
+
+/*
+ * Counts the beats requested by the event queue of a runtime, one for every
+ * state update dispatched through its `EventDispatcher`.
+ */
+class CountingEventBeat : public EventBeat {
+ public:
+  CountingEventBeat(SharedOwnerBox ownerBox, int& requestCount)
+      : EventBeat(std::move(ownerBox)), requestCount_(requestCount) {}
+
+  void request() const override {
+    requestCount_++;
+    EventBeat::request();
+  }
+
+ private:
+  int& requestCount_;
+};
+
+EventBeat::Factory countingEventBeatFactory(int& requestCount) {
+  return [&requestCount](const EventBeat::SharedOwnerBox& ownerBox) {
+    return std::make_unique<CountingEventBeat>(ownerBox, requestCount);
+  };
+}
+
+/*
+ * Queues the work instead of running it; there is no JavaScript runtime.
+ */
+RuntimeExecutor recordingRuntimeExecutor(
+    std::vector<std::function<void(jsi::Runtime&)>>& work) {
+  return [&work](std::function<void(jsi::Runtime & runtime)>&& callback) {
+    work.push_back(std::move(callback));
+  };
+}
+
+void dispatchStateUpdate(const ShadowNodeFamily& family) {
+  family.dispatchRawState(
+      {nullptr, [](const StateData::Shared& data) { return data; }});
+}
+
+} // namespace
+
+class SchedulerTest : public ::testing::Test {
+ protected:
+  static constexpr SurfaceId kMainSurfaceId = 1;
+  static constexpr SurfaceId kRuntimeSurfaceId = 11;
+
+  SchedulerTest() {
+    providerRegistry_.add(
+        concreteComponentDescriptorProvider<RootComponentDescriptor>());
+    providerRegistry_.add(
+        concreteComponentDescriptorProvider<ViewComponentDescriptor>());
+
+    auto contextContainer = std::make_shared<ContextContainer>();
+    contextContainer->insert(
+        "ReactNativeConfig",
+        std::shared_ptr<const ReactNativeConfig>(
+            std::make_shared<const EmptyReactNativeConfig>()));
+
+    auto toolbox = SchedulerToolbox{};
+    toolbox.contextContainer = contextContainer;
+    toolbox.componentRegistryFactory =
+        [this](
+            const EventDispatcher::Weak& eventDispatcher,
+            const ContextContainer::Shared& contextContainer) {
+          return providerRegistry_.createComponentDescriptorRegistry(
+              {eventDispatcher, contextContainer, nullptr});
+        };
+    toolbox.runtimeExecutor = recordingRuntimeExecutor(mainRuntimeWork_);
+    toolbox.asynchronousEventBeatFactory =
+        countingEventBeatFactory(mainBeatRequests_);
+    toolbox.synchronousEventBeatFactory =
+        countingEventBeatFactory(mainBeatRequests_);
+    scheduler_ = std::make_unique<Scheduler>(toolbox, nullptr, nullptr);
+
+    runtimeId_ = scheduler_->registerRuntime(SchedulerRuntimeToolbox{
+        /* .runtimeExecutor = */ recordingRuntimeExecutor(runtimeWork_),
+        /* .asynchronousEventBeatFactory = */
+        countingEventBeatFactory(runtimeBeatRequests_),
+        /* .synchronousEventBeatFactory = */
+        countingEventBeatFactory(runtimeBeatRequests_),
+    });
+
+    for (auto* surfaceHandler : surfaceHandlers()) {
+      surfaceHandler->constraintLayout(
+          LayoutConstraints{{0, 0}, {100, 100}, LayoutDirection::LeftToRight},
+          LayoutContext{});
+    }
+    scheduler_->registerSurface(mainSurfaceHandler_);
+    scheduler_->registerSurface(runtimeSurfaceHandler_, runtimeId_);
+  }
+
+  ~SchedulerTest() override {
+    for (auto* surfaceHandler : surfaceHandlers()) {
+      if (surfaceHandler->getStatus() == SurfaceHandler::Status::Running) {
+        surfaceHandler->stop();
+      }
+      scheduler_->unregisterSurface(*surfaceHandler);
+    }
+    scheduler_->unregisterRuntime(runtimeId_);
+  }
+
+  std::vector<SurfaceHandler*> surfaceHandlers() {
+    return {&mainSurfaceHandler_, &runtimeSurfaceHandler_};
+  }
+
+  /*
+   * Dispatches a state update through the root node of the surface.
+   */
+  void dispatchRootStateUpdate(SurfaceId surfaceId) {
+    scheduler_->getUIManager()->getShadowTreeRegistry().visit(
+        surfaceId, [](const ShadowTree& shadowTree) {
+          dispatchStateUpdate(
+              shadowTree.getCurrentRevision().rootShadowNode->getFamily());
+        });
+  }
+
+  ComponentDescriptorProviderRegistry providerRegistry_;
+  std::vector<std::function<void(jsi::Runtime&)>> mainRuntimeWork_;
+  std::vector<std::function<void(jsi::Runtime&)>> runtimeWork_;
+  int mainBeatRequests_{0};
+  int runtimeBeatRequests_{0};
+  std::unique_ptr<Scheduler> scheduler_;
+  Scheduler::RuntimeId runtimeId_{};
+  SurfaceHandler mainSurfaceHandler_{"Main", kMainSurfaceId};
+  SurfaceHandler runtimeSurfaceHandler_{"Runtime", kRuntimeSurfaceId};
+};
+
+TEST_F(SchedulerTest, surfacesRunOnTheExecutorOfTheirRuntime) {
+  auto uiManager = scheduler_->getUIManager();
+  auto mainWorkCount = mainRuntimeWork_.size();
+  // Installing the binding of the UIManager.
+  EXPECT_EQ(runtimeWork_.size(), 1);
+
+  runtimeSurfaceHandler_.start();
+  EXPECT_EQ(runtimeWork_.size(), 2);
+  runtimeSurfaceHandler_.stop();
+  EXPECT_EQ(runtimeWork_.size(), 3);
+  EXPECT_EQ(mainRuntimeWork_.size(), mainWorkCount);
+
+  // In debug builds, the leak checker also runs on the main runtime.
+  mainSurfaceHandler_.start();
+  mainSurfaceHandler_.stop();
+  EXPECT_GE(mainRuntimeWork_.size(), mainWorkCount + 2);
+  EXPECT_EQ(runtimeWork_.size(), 3);
+
+  // The executor is looked up by surface.
+  mainWorkCount = mainRuntimeWork_.size();
+  uiManager->getSurfaceRuntimeExecutor(kRuntimeSurfaceId)(
+      [](jsi::Runtime& /*runtime*/) {});
+  EXPECT_EQ(runtimeWork_.size(), 4);
+  uiManager->getSurfaceRuntimeExecutor(kMainSurfaceId)(
+      [](jsi::Runtime& /*runtime*/) {});
+  EXPECT_EQ(mainRuntimeWork_.size(), mainWorkCount + 1);
+}
+
+TEST_F(SchedulerTest, familiesUseTheDispatcherOfTheirRuntime) {
+  auto uiManager = scheduler_->getUIManager();
+  EXPECT_EQ(uiManager->getSurfaceEventDispatcher(kMainSurfaceId), nullptr);
+  EXPECT_NE(uiManager->getSurfaceEventDispatcher(kRuntimeSurfaceId), nullptr);
+
+  runtimeSurfaceHandler_.start();
+  mainSurfaceHandler_.start();
+
+  auto runtimeNode = uiManager->createNode(
+      100, "View", kRuntimeSurfaceId, RawProps(folly::dynamic::object()), {});
+  dispatchStateUpdate(runtimeNode->getFamily());
+  EXPECT_EQ(runtimeBeatRequests_, 1);
+  EXPECT_EQ(mainBeatRequests_, 0);
+
+  auto mainNode = uiManager->createNode(
+      101, "View", kMainSurfaceId, RawProps(folly::dynamic::object()), {});
+  dispatchStateUpdate(mainNode->getFamily());
+  EXPECT_EQ(runtimeBeatRequests_, 1);
+  EXPECT_EQ(mainBeatRequests_, 1);
+}
+
+TEST_F(SchedulerTest, rootFamiliesUseTheDispatcherOfTheirRuntime) {
+  runtimeSurfaceHandler_.start();
+  mainSurfaceHandler_.start();
+
+  dispatchRootStateUpdate(kRuntimeSurfaceId);
+  EXPECT_EQ(runtimeBeatRequests_, 1);
+  EXPECT_EQ(mainBeatRequests_, 0);
+
+  // The root component descriptor is shared by all trees and has no
+  // dispatcher of its own.
+  dispatchRootStateUpdate(kMainSurfaceId);
+  EXPECT_EQ(runtimeBeatRequests_, 1);
+  EXPECT_EQ(mainBeatRequests_, 0);
+}
+
+TEST_F(SchedulerTest, surfacesOfUnknownRuntimesAreRejected) {
+  auto surfaceHandler = SurfaceHandler{"Unknown", 21};
+
+  EXPECT_THROW(
+      scheduler_->registerSurface(surfaceHandler, runtimeId_ + 1),
+      std::invalid_argument);
+  EXPECT_EQ(surfaceHandler.getStatus(), SurfaceHandler::Status::Unregistered);
+}
@@ -77,7 +77,10 @@ std::shared_ptr<ShadowNode> UIManager::createNode(
   PropsParserContext propsParserContext{surfaceId, *contextContainer_.get()};
 
   auto family = componentDescriptor.createFamily(
-      {tag, surfaceId, std::move(instanceHandle)});
+      {tag,
+       surfaceId,
+       std::move(instanceHandle),
+       getSurfaceEventDispatcher(surfaceId)});
   const auto props = componentDescriptor.cloneProps(
       propsParserContext, nullptr, std::move(rawProps));
   const auto state = componentDescriptor.createInitialState(props, family);
@@ -203,7 +206,7 @@ void UIManager::startSurface(
   auto surfaceId = shadowTree->getSurfaceId();
   shadowTreeRegistry_.add(std::move(shadowTree));
 
-  runtimeExecutor_([=](jsi::Runtime& runtime) {
+  getSurfaceRuntimeExecutor(surfaceId)([=](jsi::Runtime& runtime) {
     SystraceSection s("UIManager::startSurface::onRuntime");
     SurfaceRegistryBinding::startSurface(
         runtime, surfaceId, moduleName, props, displayMode);
@@ -217,7 +220,7 @@ void UIManager::setSurfaceProps(
     DisplayMode displayMode) const {
   SystraceSection s("UIManager::setSurfaceProps");
 
-  runtimeExecutor_([=](jsi::Runtime& runtime) {
+  getSurfaceRuntimeExecutor(surfaceId)([=](jsi::Runtime& runtime) {
     SurfaceRegistryBinding::setSurfaceProps(
         runtime, surfaceId, moduleName, props, displayMode);
   });
@@ -237,7 +240,7 @@ ShadowTree::Unique UIManager::stopSurface(SurfaceId surfaceId) const {
     // minimize any visible side-effects of stopping the Surface. Any possible
     // commits from the JavaScript side will not be able to reference a
     // `ShadowTree` and will fail silently.
-    runtimeExecutor_([=](jsi::Runtime& runtime) {
+    getSurfaceRuntimeExecutor(surfaceId)([=](jsi::Runtime& runtime) {
       SurfaceRegistryBinding::stopSurface(runtime, surfaceId);
     });
 
@@ -248,6 +251,39 @@ ShadowTree::Unique UIManager::stopSurface(SurfaceId surfaceId) const {
   return shadowTree;
 }
 
+void UIManager::setSurfaceRuntime(
+    SurfaceId surfaceId,
+    RuntimeExecutor runtimeExecutor,
+    EventDispatcher::Weak eventDispatcher) const {
+  std::unique_lock lock(surfaceRuntimesMutex_);
+  surfaceRuntimes_[surfaceId] =
+      SurfaceRuntime{std::move(runtimeExecutor), std::move(eventDispatcher)};
+}
+
+void UIManager::removeSurfaceRuntime(SurfaceId surfaceId) const {
+  std::unique_lock lock(surfaceRuntimesMutex_);
+  surfaceRuntimes_.erase(surfaceId);
+}
+
+RuntimeExecutor UIManager::getSurfaceRuntimeExecutor(
+    SurfaceId surfaceId) const {
+  std::shared_lock lock(surfaceRuntimesMutex_);
+  auto it = surfaceRuntimes_.find(surfaceId);
+  return it == surfaceRuntimes_.end() ? runtimeExecutor_
+                                      : it->second.runtimeExecutor;
+}
+
+EventDispatcher::Shared UIManager::getSurfaceEventDispatcher(
+    SurfaceId surfaceId) const {
+  std::shared_lock lock(surfaceRuntimesMutex_);
+  if (surfaceRuntimes_.empty()) {
+    return nullptr;
+  }
+  auto it = surfaceRuntimes_.find(surfaceId);
+  return it == surfaceRuntimes_.end() ? nullptr
+                                      : it->second.eventDispatcher.lock();
+}
+
 ShadowNode::Shared UIManager::getNewestCloneOfShadowNode(
     const ShadowNode& shadowNode) const {
   auto ancestorShadowNode = ShadowNode::Shared{};
@@ -12,6 +12,7 @@
 
 #include <ReactCommon/RuntimeExecutor.h>
 #include <shared_mutex>
+#include <unordered_map>
 
 #include <react/renderer/componentregistry/ComponentDescriptorRegistry.h>
 #include <react/renderer/core/InstanceHandle.h>
@@ -122,6 +123,31 @@ class UIManager final : public ShadowTreeDelegate {
 
   ShadowTree::Unique stopSurface(SurfaceId surfaceId) const;
 
+  /*
+   * Binds a surface to another JavaScript runtime than the one the
+   * `UIManager` was created with: the surface is started, updated and stopped
+   * on `runtimeExecutor`, and the events of its components are dispatched
+   * through `eventDispatcher`. Must be called before the surface starts.
+   * Surfaces of different runtimes share the component registry and the
+   * mounting pipeline, and are committed concurrently by their runtimes.
+   */
+  void setSurfaceRuntime(
+      SurfaceId surfaceId,
+      RuntimeExecutor runtimeExecutor,
+      EventDispatcher::Weak eventDispatcher) const;
+  void removeSurfaceRuntime(SurfaceId surfaceId) const;
+
+  /*
+   * Returns the executor of the runtime rendering the surface.
+   */
+  RuntimeExecutor getSurfaceRuntimeExecutor(SurfaceId surfaceId) const;
+
+  /*
+   * Returns the event dispatcher of the runtime rendering the surface, or
+   * `nullptr` if it is the one the `UIManager` was created with.
+   */
+  EventDispatcher::Shared getSurfaceEventDispatcher(SurfaceId surfaceId) const;
+
 #pragma mark - ShadowTreeDelegate
 
   void shadowTreeDidFinishTransaction(
@@ -223,6 +249,11 @@ class UIManager final : public ShadowTreeDelegate {
       const jsi::Value& successCallback,
       const jsi::Value& failureCallback) const;
 
+  struct SurfaceRuntime {
+    RuntimeExecutor runtimeExecutor;
+    EventDispatcher::Weak eventDispatcher;
+  };
+
   SharedComponentDescriptorRegistry componentDescriptorRegistry_;
   UIManagerDelegate* delegate_{};
   UIManagerAnimationDelegate* animationDelegate_{nullptr};
@@ -237,6 +268,9 @@ class UIManager final : public ShadowTreeDelegate {
   mutable std::shared_mutex mountHookMutex_;
   mutable std::vector<UIManagerMountHook*> mountHooks_;
 
+  mutable std::shared_mutex surfaceRuntimesMutex_;
+  mutable std::unordered_map<SurfaceId, SurfaceRuntime> surfaceRuntimes_;
+
   std::unique_ptr<LeakChecker> leakChecker_;
 };
 
@@ -10,6 +10,7 @@
 #include <ReactCommon/RuntimeExecutor.h>
 #include <cxxreact/ErrorUtils.h>
 #include <cxxreact/JSBigString.h>
+#include <cxxreact/JSBigStringRegistry.h>
 #include <cxxreact/JSExecutor.h>
 #include <cxxreact/ReactMarker.h>
 #include <cxxreact/SystraceSection.h>
@@ -287,7 +288,7 @@ void ReactInstance::registerSegment(
   runtimeScheduler_->scheduleWork([=](jsi::Runtime& runtime) {
     SystraceSection s("ReactInstance::registerSegment");
     const auto tag = folly::to<std::string>(segmentId);
-    auto script = JSBigFileString::fromPath(segmentPath);
+    auto script = JSBigStringRegistry::shared().fromPath(segmentPath);
     if (script->size() == 0) {
       throw std::invalid_argument(
           "Empty segment registered with ID " + tag + " from " + segmentPath);
@@ -16,5 +16,8 @@ bool CoreFeatures::enableGranularShadowTreeStateReconciliation = false;
 bool CoreFeatures::enableClonelessStateProgression = false;
 bool CoreFeatures::excludeYogaFromRawProps = false;
 bool CoreFeatures::enableReportEventPaintTime = false;
+bool CoreFeatures::enableDeferredRevisionDestruction = false;
+bool CoreFeatures::cacheFlattenedViewLayers = false;
+bool CoreFeatures::cacheParsedProps = false;
 
 } // namespace facebook::react
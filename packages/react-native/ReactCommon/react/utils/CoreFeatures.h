@@ -42,6 +42,20 @@ class CoreFeatures {
   // Report paint time inside the Event Timing API implementation
   // (PerformanceObserver).
   static bool enableReportEventPaintTime;
+
+  // When enabled, retired shadow tree revisions are destroyed on a background
+  // thread instead of the thread releasing them.
+  static bool enableDeferredRevisionDestruction;
+
+  // When enabled, each MountingCoordinator keeps the flattened view layers of
+  // the last diffed revision and the Differentiator reuses them in the next
+  // diff (see `ViewLayerCache`).
+  static bool cacheFlattenedViewLayers;
+
+  // When enabled, component descriptors keep props parsed from scratch and
+  // copy them for nodes created with identical raw props instead of parsing
+  // them again.
+  static bool cacheParsedProps;
 };
 
 } // namespace facebook::react
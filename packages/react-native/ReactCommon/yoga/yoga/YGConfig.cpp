@@ -90,3 +90,9 @@ void YGConfigSetCloneNodeFunc(
     const YGCloneNodeFunc callback) {
   resolveRef(config)->setCloneNodeCallback(callback);
 }
+
+void YGConfigSetMeasureBatchFunc(
+    const YGConfigRef config,
+    const YGMeasureBatchFunc measureBatchFunc) {
+  resolveRef(config)->setMeasureBatchFunc(measureBatchFunc);
+}
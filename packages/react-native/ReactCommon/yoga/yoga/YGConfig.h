@@ -155,4 +155,39 @@ YG_EXPORT void YGConfigSetCloneNodeFunc(
     YGConfigRef config,
     YGCloneNodeFunc callback);
 
+/**
+ * A request to measure a node with a measure function, as passed to a
+ * YGMeasureBatchFunc. `measuredWidth` and `measuredHeight` are initially
+ * undefined, and should be set to the size the node's measure function would
+ * return under the given constraints.
+ */
+typedef struct YGMeasureRequest {
+  YGNodeConstRef node;
+  float width;
+  YGMeasureMode widthMode;
+  float height;
+  YGMeasureMode heightMode;
+  float measuredWidth;
+  float measuredHeight;
+} YGMeasureRequest;
+
+/**
+ * Function pointer type for YGConfigSetMeasureBatchFunc.
+ */
+typedef void (*YGMeasureBatchFunc)(
+    YGConfigConstRef config,
+    YGMeasureRequest* requests,
+    size_t count);
+
+/**
+ * Sets a callback, called at the start of layout, to measure the leaf nodes
+ * whose measure constraints Yoga can predict ahead of the pass. This allows
+ * measuring many nodes concurrently, or in a single platform call. Results are
+ * used in place of calling the node's measure function when the constraints
+ * match. Requests left unmeasured fall back to the node's measure function.
+ */
+YG_EXPORT void YGConfigSetMeasureBatchFunc(
+    YGConfigRef config,
+    YGMeasureBatchFunc measureBatchFunc);
+
 YG_EXTERN_C_END
@@ -21,7 +21,9 @@
 #include <yoga/algorithm/CalculateLayout.h>
 #include <yoga/algorithm/FlexDirection.h>
 #include <yoga/algorithm/FlexLine.h>
+#include <yoga/algorithm/MeasureBatch.h>
 #include <yoga/algorithm/PixelGrid.h>
+#include <yoga/algorithm/ScratchArena.h>
 #include <yoga/algorithm/SizingMode.h>
 #include <yoga/algorithm/TrailingPosition.h>
 #include <yoga/debug/AssertFatal.h>
@@ -303,28 +305,46 @@ static void measureNodeWithMeasureFunc(
             ownerWidth),
         Dimension::Height);
   } else {
-    Event::publish<Event::MeasureCallbackStart>(node);
+    // Use the result of a batched measurement if one was made ahead of the
+    // pass under the same constraints.
+    const std::optional<YGSize> batchedSize =
+        layoutMarkerData.measureBatch != nullptr
+        ? layoutMarkerData.measureBatch->find(
+              node,
+              innerWidth,
+              measureMode(widthSizingMode),
+              innerHeight,
+              measureMode(heightSizingMode))
+        : std::nullopt;
+
+    YGSize measuredSize;
+    if (batchedSize.has_value()) {
+      measuredSize = *batchedSize;
+      layoutMarkerData.measureBatchHits += 1;
+    } else {
+      Event::publish<Event::MeasureCallbackStart>(node);
 
-    // Measure the text under the current constraints.
-    const YGSize measuredSize = node->measure(
-        innerWidth,
-        measureMode(widthSizingMode),
-        innerHeight,
-        measureMode(heightSizingMode));
+      // Measure the text under the current constraints.
+      measuredSize = node->measure(
+          innerWidth,
+          measureMode(widthSizingMode),
+          innerHeight,
+          measureMode(heightSizingMode));
 
-    layoutMarkerData.measureCallbacks += 1;
-    layoutMarkerData.measureCallbackReasonsCount[static_cast<size_t>(reason)] +=
-        1;
+      layoutMarkerData.measureCallbacks += 1;
+      layoutMarkerData
+          .measureCallbackReasonsCount[static_cast<size_t>(reason)] += 1;
 
-    Event::publish<Event::MeasureCallbackEnd>(
-        node,
-        {innerWidth,
-         unscopedEnum(measureMode(widthSizingMode)),
-         innerHeight,
-         unscopedEnum(measureMode(heightSizingMode)),
-         measuredSize.width,
-         measuredSize.height,
-         reason});
+      Event::publish<Event::MeasureCallbackEnd>(
+          node,
+          {innerWidth,
+           unscopedEnum(measureMode(widthSizingMode)),
+           innerHeight,
+           unscopedEnum(measureMode(heightSizingMode)),
+           measuredSize.width,
+           measuredSize.height,
+           reason});
+    }
 
     node->setLayoutMeasuredDimension(
         boundAxis(
@@ -1410,6 +1430,8 @@ static void calculateLayoutImpl(
   float maxLineMainDim = 0;
   for (; endOfLineIndex < childCount;
        lineCount++, startOfLineIndex = endOfLineIndex) {
+    // Scratch memory for the line is released once we move onto the next one.
+    ScratchArena::Scope scratchScope{*layoutMarkerData.scratch};
     auto flexLine = calculateFlexLine(
         node,
         ownerDirection,
@@ -1417,7 +1439,8 @@ static void calculateLayoutImpl(
         availableInnerWidth,
         availableInnerMainDim,
         startOfLineIndex,
-        lineCount);
+        lineCount,
+        *layoutMarkerData.scratch);
 
     endOfLineIndex = flexLine.endOfLineIndex;
 
@@ -2288,13 +2311,132 @@ bool calculateLayoutInternal(
   return (needToVisitNode || cachedResults == nullptr);
 }
 
+// Whether layout of `node` cannot be satisfied from results of a previous pass
+static bool needsLayout(const yoga::Node* const node) {
+  const auto& layout = node->getLayout();
+  return node->isDirty() ||
+      (layout.nextCachedMeasurementsIndex == 0 &&
+       layout.cachedLayout.computedWidth < 0);
+}
+
+// Collects measure requests for the dirty or new descendants of `node` whose
+// constraints can be known before layout. This covers the common case of
+// leaves with measure functions inside column containers of definite width,
+// where the request mirrors the one made when computing the leaf's flex basis.
+// `availableInnerWidth` must be definite, and be the inner width `node` is laid
+// out with. Predictions which turn out to be wrong are harmless, as the result
+// is only used if a measurement is made under the same constraints.
+static void collectMeasureRequests(
+    const yoga::Node* const node,
+    const float availableInnerWidth,
+    const float availableInnerHeight,
+    MeasureBatch& batch) {
+  if (!isColumn(node->style().flexDirection())) {
+    return;
+  }
+
+  const bool canUseInnerHeight = yoga::isDefined(availableInnerHeight) &&
+      node->style().overflow() != Overflow::Scroll;
+
+  for (const auto child : node->getChildren()) {
+    const auto& childStyle = child->style();
+    if (!needsLayout(child) || childStyle.display() == Display::None ||
+        childStyle.positionType() == PositionType::Absolute ||
+        child->resolveFlexGrow() != 0.0f ||
+        child->resolveFlexShrink() != 0.0f ||
+        child->resolveFlexBasisPtr().unit() != Unit::Auto ||
+        childStyle.aspectRatio().isDefined() ||
+        childStyle.minDimension(Dimension::Width).isDefined() ||
+        childStyle.maxDimension(Dimension::Width).isDefined() ||
+        childStyle.minDimension(Dimension::Height).isDefined() ||
+        childStyle.maxDimension(Dimension::Height).isDefined()) {
+      continue;
+    }
+
+    const float marginRow =
+        childStyle.computeMarginForAxis(FlexDirection::Row, availableInnerWidth);
+    const float marginColumn = childStyle.computeMarginForAxis(
+        FlexDirection::Column, availableInnerWidth);
+
+    const FloatOptional styleWidth =
+        childStyle.dimension(Dimension::Width).resolve(availableInnerWidth);
+    const FloatOptional styleHeight =
+        childStyle.dimension(Dimension::Height).resolve(availableInnerHeight);
+
+    float childWidth = availableInnerWidth;
+    SizingMode childWidthSizingMode = SizingMode::FitContent;
+    if (styleWidth.isDefined() && styleWidth.unwrap() >= 0.0f) {
+      childWidth = styleWidth.unwrap() + marginRow;
+      childWidthSizingMode = SizingMode::StretchFit;
+    } else if (resolveChildAlignment(node, child) == Align::Stretch) {
+      childWidthSizingMode = SizingMode::StretchFit;
+    }
+
+    float childHeight = YGUndefined;
+    SizingMode childHeightSizingMode = SizingMode::MaxContent;
+    if (styleHeight.isDefined() && styleHeight.unwrap() >= 0.0f) {
+      childHeight = styleHeight.unwrap() + marginColumn;
+      childHeightSizingMode = SizingMode::StretchFit;
+    } else if (canUseInnerHeight) {
+      childHeight = availableInnerHeight;
+      childHeightSizingMode = SizingMode::FitContent;
+    }
+
+    const float paddingAndBorderAxisRow =
+        childStyle.computeInlineStartPadding(
+            FlexDirection::Row, Direction::LTR, availableInnerWidth) +
+        childStyle.computeInlineEndPadding(
+            FlexDirection::Row, Direction::LTR, availableInnerWidth) +
+        childStyle.computeInlineStartBorder(FlexDirection::Row, Direction::LTR) +
+        childStyle.computeInlineEndBorder(FlexDirection::Row, Direction::LTR);
+    const float paddingAndBorderAxisColumn =
+        childStyle.computeInlineStartPadding(
+            FlexDirection::Column, Direction::LTR, availableInnerWidth) +
+        childStyle.computeInlineEndPadding(
+            FlexDirection::Column, Direction::LTR, availableInnerWidth) +
+        childStyle.computeInlineStartBorder(
+            FlexDirection::Column, Direction::LTR) +
+        childStyle.computeInlineEndBorder(FlexDirection::Column, Direction::LTR);
+
+    if (child->hasMeasureFunc()) {
+      // A definite height means the flex basis comes from style, and a node
+      // sized exactly in both axes is never measured.
+      if (childHeightSizingMode == SizingMode::StretchFit) {
+        continue;
+      }
+      const float innerWidth = yoga::maxOrDefined(
+          0.0f, childWidth - marginRow - paddingAndBorderAxisRow);
+      const float innerHeight = yoga::isUndefined(childHeight)
+          ? childHeight
+          : yoga::maxOrDefined(
+                0.0f, childHeight - marginColumn - paddingAndBorderAxisColumn);
+      batch.add(
+          child,
+          innerWidth,
+          measureMode(childWidthSizingMode),
+          innerHeight,
+          measureMode(childHeightSizingMode));
+    } else if (childWidthSizingMode == SizingMode::StretchFit) {
+      collectMeasureRequests(
+          child,
+          childWidth - marginRow - paddingAndBorderAxisRow,
+          yoga::isUndefined(childHeight)
+              ? childHeight
+              : childHeight - marginColumn - paddingAndBorderAxisColumn,
+          batch);
+    }
+  }
+}
+
 void calculateLayout(
     yoga::Node* const node,
     const float ownerWidth,
     const float ownerHeight,
     const Direction ownerDirection) {
   Event::publish<Event::LayoutPassStart>(node);
+  ScratchArena scratch;
   LayoutData markerData = {};
+  markerData.scratch = &scratch;
 
   // Increment the generation count. This will force the recursive routine to
   // visit all dirty nodes at least once. Subsequent visits will be skipped if
@@ -2342,6 +2484,32 @@ void calculateLayout(
     heightSizingMode = yoga::isUndefined(height) ? SizingMode::MaxContent
                                                  : SizingMode::StretchFit;
   }
+
+  MeasureBatch measureBatch;
+  if (node->getConfig()->hasMeasureBatchFunc() && needsLayout(node) &&
+      !node->hasMeasureFunc() && widthSizingMode == SizingMode::StretchFit) {
+    collectMeasureRequests(
+        node,
+        calculateAvailableInnerDimension(
+            node,
+            Dimension::Width,
+            width -
+                style.computeMarginForAxis(FlexDirection::Row, ownerWidth),
+            paddingAndBorderForAxis(node, FlexDirection::Row, ownerWidth),
+            ownerWidth),
+        calculateAvailableInnerDimension(
+            node,
+            Dimension::Height,
+            height -
+                style.computeMarginForAxis(FlexDirection::Column, ownerWidth),
+            paddingAndBorderForAxis(node, FlexDirection::Column, ownerWidth),
+            ownerHeight),
+        measureBatch);
+    measureBatch.measure(*node->getConfig());
+    markerData.measureBatchRequests = static_cast<int>(measureBatch.size());
+    markerData.measureBatch = &measureBatch;
+  }
+
   if (calculateLayoutInternal(
           node,
           width,
@@ -2361,6 +2529,9 @@ void calculateLayout(
     roundLayoutResultsToPixelGrid(node, 0.0f, 0.0f);
   }
 
+  markerData.scratchAllocations = scratch.allocationCount();
+  markerData.scratchChunkAllocations = scratch.chunkAllocationCount();
+  markerData.scratchPeakBytes = scratch.peakBytes();
   Event::publish<Event::LayoutPassEnd>(node, {&markerData});
 }
 
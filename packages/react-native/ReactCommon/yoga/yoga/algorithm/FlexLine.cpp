@@ -20,9 +20,12 @@ FlexLine calculateFlexLine(
     const float availableInnerWidth,
     const float availableInnerMainDim,
     const size_t startOfLineIndex,
-    const size_t lineCount) {
-  std::vector<yoga::Node*> itemsInFlow;
-  itemsInFlow.reserve(node->getChildren().size());
+    const size_t lineCount,
+    ScratchArena& scratch) {
+  // At most every remaining child can be part of the line
+  const auto itemsInFlowStorage = scratch.allocate<yoga::Node*>(
+      node->getChildren().size() - startOfLineIndex);
+  size_t itemsInFlowCount = 0;
 
   float sizeConsumed = 0.0f;
   float totalFlexGrowFactors = 0.0f;
@@ -69,7 +72,7 @@ FlexLine calculateFlexLine(
     if (sizeConsumedIncludingMinConstraint + flexBasisWithMinAndMaxConstraints +
                 childMarginMainAxis + childLeadingGapMainAxis >
             availableInnerMainDim &&
-        isNodeFlexWrap && !itemsInFlow.empty()) {
+        isNodeFlexWrap && itemsInFlowCount > 0) {
       break;
     }
 
@@ -87,7 +90,7 @@ FlexLine calculateFlexLine(
           child->getLayout().computedFlexBasis.unwrap();
     }
 
-    itemsInFlow.push_back(child);
+    itemsInFlowStorage[itemsInFlowCount++] = child;
   }
 
   // The total flex factor needs to be floored to 1.
@@ -101,7 +104,7 @@ FlexLine calculateFlexLine(
   }
 
   return FlexLine{
-      std::move(itemsInFlow),
+      itemsInFlowStorage.first(itemsInFlowCount),
       sizeConsumed,
       endOfLineIndex,
       FlexLineRunningLayout{
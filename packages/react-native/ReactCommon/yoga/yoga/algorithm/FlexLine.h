@@ -7,9 +7,10 @@
 
 #pragma once
 
-#include <vector>
+#include <span>
 
 #include <yoga/Yoga.h>
+#include <yoga/algorithm/ScratchArena.h>
 #include <yoga/node/Node.h>
 
 namespace facebook::yoga {
@@ -40,8 +41,8 @@ struct FlexLineRunningLayout {
 struct FlexLine {
   // List of children which are part of the line flow. This means they are not
   // positioned absolutely, or with `display: "none"`, and do not overflow the
-  // available dimensions.
-  const std::vector<yoga::Node*> itemsInFlow{};
+  // available dimensions. Backed by the layout pass's scratch arena.
+  const std::span<yoga::Node*> itemsInFlow{};
 
   // Accumulation of the dimensions and margin of all the children on the
   // current line. This will be used in order to either set the dimensions of
@@ -61,7 +62,8 @@ struct FlexLine {
 //
 // This function assumes that all the children of node have their
 // computedFlexBasis properly computed(To do this use
-// computeFlexBasisForChildren function).
+// computeFlexBasisForChildren function). The returned line references memory
+// in `scratch`, so must not outlive the arena's current scope.
 FlexLine calculateFlexLine(
     yoga::Node* node,
     Direction ownerDirection,
@@ -69,6 +71,7 @@ FlexLine calculateFlexLine(
     float availableInnerWidth,
     float availableInnerMainDim,
     size_t startOfLineIndex,
-    size_t lineCount);
+    size_t lineCount,
+    ScratchArena& scratch);
 
 } // namespace facebook::yoga
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <algorithm>
+#include <functional>
+
+#include <yoga/algorithm/MeasureBatch.h>
+#include <yoga/node/Node.h>
+#include <yoga/numeric/Comparison.h>
+
+namespace facebook::yoga {
+
+namespace {
+
+bool requestNodeLess(const YGMeasureRequest& lhs, YGNodeConstRef rhs) {
+  return std::less<YGNodeConstRef>{}(lhs.node, rhs);
+}
+
+} // namespace
+
+void MeasureBatch::add(
+    const yoga::Node* node,
+    float width,
+    MeasureMode widthMode,
+    float height,
+    MeasureMode heightMode) {
+  requests_.push_back(YGMeasureRequest{
+      node,
+      width,
+      unscopedEnum(widthMode),
+      height,
+      unscopedEnum(heightMode),
+      YGUndefined,
+      YGUndefined});
+}
+
+void MeasureBatch::measure(const yoga::Config& config) {
+  if (requests_.empty()) {
+    return;
+  }
+
+  // Requests are handed to the batch function in tree order, then sorted by
+  // node so they can be looked up during layout.
+  config.measureBatch(requests_.data(), requests_.size());
+  std::stable_sort(
+      requests_.begin(),
+      requests_.end(),
+      [](const YGMeasureRequest& lhs, const YGMeasureRequest& rhs) {
+        return std::less<YGNodeConstRef>{}(lhs.node, rhs.node);
+      });
+}
+
+std::optional<YGSize> MeasureBatch::find(
+    const yoga::Node* node,
+    float width,
+    MeasureMode widthMode,
+    float height,
+    MeasureMode heightMode) const {
+  for (auto it = std::lower_bound(
+           requests_.begin(), requests_.end(), node, requestNodeLess);
+       it != requests_.end() && it->node == node;
+       ++it) {
+    // The batch function may leave requests it could not measure unresolved
+    if (yoga::isUndefined(it->measuredWidth) ||
+        yoga::isUndefined(it->measuredHeight)) {
+      continue;
+    }
+    if (it->widthMode == unscopedEnum(widthMode) &&
+        it->heightMode == unscopedEnum(heightMode) &&
+        yoga::inexactEquals(it->width, width) &&
+        yoga::inexactEquals(it->height, height)) {
+      return YGSize{it->measuredWidth, it->measuredHeight};
+    }
+  }
+  return std::nullopt;
+}
+
+} // namespace facebook::yoga
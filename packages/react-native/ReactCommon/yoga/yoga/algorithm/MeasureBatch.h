@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <optional>
+#include <vector>
+
+#include <yoga/Yoga.h>
+
+#include <yoga/config/Config.h>
+#include <yoga/enums/MeasureMode.h>
+
+namespace facebook::yoga {
+
+class Node;
+
+// Measurements of leaf nodes collected ahead of a layout pass, and resolved
+// with a single call to the config's YGMeasureBatchFunc. During the pass,
+// measuring a node under the same constraints as a batched request uses the
+// batched result instead of calling the node's measure function.
+class MeasureBatch {
+ public:
+  void add(
+      const yoga::Node* node,
+      float width,
+      MeasureMode widthMode,
+      float height,
+      MeasureMode heightMode);
+
+  // Resolves all collected requests using the batch function of `config`.
+  void measure(const yoga::Config& config);
+
+  std::optional<YGSize> find(
+      const yoga::Node* node,
+      float width,
+      MeasureMode widthMode,
+      float height,
+      MeasureMode heightMode) const;
+
+  size_t size() const {
+    return requests_.size();
+  }
+
+ private:
+  std::vector<YGMeasureRequest> requests_;
+};
+
+} // namespace facebook::yoga
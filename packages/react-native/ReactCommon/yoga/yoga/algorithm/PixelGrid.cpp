@@ -5,6 +5,8 @@
  * LICENSE file in the root directory of this source tree.
  */
 
+#include <cmath>
+
 #include <yoga/Yoga.h>
 
 #include <yoga/algorithm/PixelGrid.h>
@@ -12,6 +14,23 @@
 
 namespace facebook::yoga {
 
+namespace {
+
+// Equivalent to `fmod(value, 1.0)`. Subtracting the integral part of a double
+// is exact, so this gives identical results to the much more expensive
+// general-purpose `fmod`, which dominates the cost of rounding large trees.
+inline double fractionalPart(const double value) {
+  return value - std::trunc(value);
+}
+
+bool hasFractionalPart(const double value) {
+  const double fraction = fractionalPart(value);
+  return !yoga::inexactEquals(fraction, 0) &&
+      !yoga::inexactEquals(fraction, 1.0);
+}
+
+} // namespace
+
 float roundValueToPixelGrid(
     const double value,
     const double pointScaleFactor,
@@ -20,7 +39,7 @@ float roundValueToPixelGrid(
   double scaledValue = value * pointScaleFactor;
   // We want to calculate `fractial` such that `floor(scaledValue) = scaledValue
   // - fractial`.
-  double fractial = fmod(scaledValue, 1.0);
+  double fractial = fractionalPart(scaledValue);
   if (fractial < 0) {
     // This branch is for handling negative numbers for `value`.
     //
@@ -97,11 +116,14 @@ void roundLayoutResultsToPixelGrid(
     // whole number, we don't have any fraction To verify if the result is close
     // to whole number we want to check both floor and ceil numbers
     const bool hasFractionalWidth =
-        !yoga::inexactEquals(fmod(nodeWidth * pointScaleFactor, 1.0), 0) &&
-        !yoga::inexactEquals(fmod(nodeWidth * pointScaleFactor, 1.0), 1.0);
+        hasFractionalPart(nodeWidth * pointScaleFactor);
     const bool hasFractionalHeight =
-        !yoga::inexactEquals(fmod(nodeHeight * pointScaleFactor, 1.0), 0) &&
-        !yoga::inexactEquals(fmod(nodeHeight * pointScaleFactor, 1.0), 1.0);
+        hasFractionalPart(nodeHeight * pointScaleFactor);
+
+    const float roundedAbsoluteLeft = roundValueToPixelGrid(
+        absoluteNodeLeft, pointScaleFactor, false, textRounding);
+    const float roundedAbsoluteTop = roundValueToPixelGrid(
+        absoluteNodeTop, pointScaleFactor, false, textRounding);
 
     node->setLayoutDimension(
         roundValueToPixelGrid(
@@ -109,8 +131,7 @@ void roundLayoutResultsToPixelGrid(
             pointScaleFactor,
             (textRounding && hasFractionalWidth),
             (textRounding && !hasFractionalWidth)) -
-            roundValueToPixelGrid(
-                absoluteNodeLeft, pointScaleFactor, false, textRounding),
+            roundedAbsoluteLeft,
         Dimension::Width);
 
     node->setLayoutDimension(
@@ -119,8 +140,7 @@ void roundLayoutResultsToPixelGrid(
             pointScaleFactor,
             (textRounding && hasFractionalHeight),
             (textRounding && !hasFractionalHeight)) -
-            roundValueToPixelGrid(
-                absoluteNodeTop, pointScaleFactor, false, textRounding),
+            roundedAbsoluteTop,
         Dimension::Height);
   }
 
@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <algorithm>
+
+#include <yoga/algorithm/ScratchArena.h>
+
+namespace facebook::yoga {
+
+namespace {
+
+// Enough for the flex lines of a few levels of typically sized containers
+constexpr size_t kMinChunkSize = 4096;
+
+size_t alignUp(size_t value, size_t alignment) {
+  return (value + alignment - 1) & ~(alignment - 1);
+}
+
+} // namespace
+
+void* ScratchArena::allocateBytes(size_t size, size_t alignment) {
+  allocationCount_++;
+
+  // Find the first chunk, starting from the current one, with enough space
+  // left. Skipped space at the end of a chunk is reclaimed on rewind.
+  while (chunkIndex_ < chunks_.size()) {
+    auto& chunk = chunks_[chunkIndex_];
+    const size_t start = alignUp(offset_, alignment);
+    if (start + size <= chunk.capacity) {
+      offset_ = start + size;
+      peakBytes_ = std::max(peakBytes_, chunk.base + offset_);
+      return chunk.data.get() + start;
+    }
+    chunkIndex_++;
+    offset_ = 0;
+  }
+
+  // Chunks are allocated with `new[]`, which is aligned to at least
+  // `__STDCPP_DEFAULT_NEW_ALIGNMENT__`, so an aligned offset of zero is valid
+  // for every type we allocate.
+  const size_t base = chunks_.empty()
+      ? 0
+      : chunks_.back().base + chunks_.back().capacity;
+  const size_t capacity = std::max({kMinChunkSize, size, base});
+  chunks_.push_back(Chunk{
+      std::unique_ptr<std::byte[]>(new std::byte[capacity]), capacity, base});
+
+  chunkIndex_ = chunks_.size() - 1;
+  offset_ = size;
+  peakBytes_ = std::max(peakBytes_, base + offset_);
+  return chunks_.back().data.get();
+}
+
+} // namespace facebook::yoga
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace facebook::yoga {
+
+// Bump allocator for temporaries which only live for part of a layout pass
+// (e.g. the list of items in a flex line). Memory is handed out in stack
+// order, and released by rewinding to a previously saved position using
+// `ScratchArena::Scope`. Chunks are retained once allocated, so a pass only
+// touches the heap when the arena needs to grow.
+class ScratchArena {
+ public:
+  // Restores the arena to its position at construction when destroyed. Any
+  // memory allocated from the arena during the lifetime of the scope must not
+  // be used afterwards.
+  class Scope {
+   public:
+    explicit Scope(ScratchArena& arena)
+        : arena_{arena},
+          chunkIndex_{arena.chunkIndex_},
+          offset_{arena.offset_} {}
+
+    ~Scope() {
+      arena_.chunkIndex_ = chunkIndex_;
+      arena_.offset_ = offset_;
+    }
+
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+
+   private:
+    ScratchArena& arena_;
+    size_t chunkIndex_;
+    size_t offset_;
+  };
+
+  ScratchArena() = default;
+  ScratchArena(const ScratchArena&) = delete;
+  ScratchArena& operator=(const ScratchArena&) = delete;
+
+  // Returns uninitialized storage for `count` elements of `T`. Destructors are
+  // never run, so only trivially destructible types may be allocated.
+  template <typename T>
+  std::span<T> allocate(size_t count) {
+    static_assert(
+        std::is_trivially_destructible_v<T>,
+        "ScratchArena does not run destructors");
+    if (count == 0) {
+      return {};
+    }
+    return {
+        static_cast<T*>(allocateBytes(count * sizeof(T), alignof(T))), count};
+  }
+
+  // Number of allocations served by the arena
+  uint32_t allocationCount() const {
+    return allocationCount_;
+  }
+
+  // Number of heap allocations the arena made to back those allocations
+  uint32_t chunkAllocationCount() const {
+    return static_cast<uint32_t>(chunks_.size());
+  }
+
+  // Highest number of bytes simultaneously in use
+  size_t peakBytes() const {
+    return peakBytes_;
+  }
+
+ private:
+  struct Chunk {
+    std::unique_ptr<std::byte[]> data;
+    size_t capacity;
+    // Sum of capacities of all chunks before this one
+    size_t base;
+  };
+
+  void* allocateBytes(size_t size, size_t alignment);
+
+  std::vector<Chunk> chunks_;
+  size_t chunkIndex_{0};
+  size_t offset_{0};
+  uint32_t allocationCount_{0};
+  size_t peakBytes_{0};
+};
+
+} // namespace facebook::yoga
@@ -7,6 +7,7 @@
 
 #include <yoga/config/Config.h>
 #include <yoga/debug/Log.h>
+#include <yoga/event/LayoutCounters.h>
 #include <yoga/node/Node.h>
 
 namespace facebook::yoga {
@@ -108,6 +109,43 @@ YGNodeRef Config::cloneNode(
   return clone;
 }
 
+void Config::setMeasureBatchFunc(YGMeasureBatchFunc measureBatchFunc) {
+  measureBatchFunc_ = measureBatchFunc;
+}
+
+bool Config::hasMeasureBatchFunc() const {
+  return measureBatchFunc_ != nullptr;
+}
+
+void Config::measureBatch(YGMeasureRequest* requests, size_t count) const {
+  measureBatchFunc_(this, requests, count);
+}
+
+void Config::subscribeToEvents(
+    std::function<Event::Subscriber>&& subscriber,
+    Event::TypeSet types) {
+  eventSubscribers_.subscribe(std::move(subscriber), types);
+}
+
+void Config::resetEventSubscribers() {
+  eventSubscribers_.reset();
+}
+
+const EventSubscribers& Config::getEventSubscribers() const {
+  return eventSubscribers_;
+}
+
+void Config::setLayoutCounters(LayoutCounters* counters) {
+  layoutCounters_ = counters;
+  if (counters != nullptr) {
+    EventSubscribers::activate(LayoutCounters::kEventTypes);
+  }
+}
+
+LayoutCounters* Config::getLayoutCounters() const {
+  return layoutCounters_;
+}
+
 /*static*/ const Config& Config::getDefault() {
   static Config config{getDefaultLogger()};
   return config;
@@ -13,6 +13,7 @@
 #include <yoga/enums/Errata.h>
 #include <yoga/enums/ExperimentalFeature.h>
 #include <yoga/enums/LogLevel.h>
+#include <yoga/event/event.h>
 
 // Tag struct used to form the opaque YGConfigRef for the public C API
 struct YGConfig {};
@@ -20,6 +21,7 @@ struct YGConfig {};
 namespace facebook::yoga {
 
 class Config;
+class LayoutCounters;
 class Node;
 
 using ExperimentalFeatureSet = std::bitset<ordinalCount<ExperimentalFeature>()>;
@@ -64,10 +66,28 @@ class YG_EXPORT Config : public ::YGConfig {
   YGNodeRef
   cloneNode(YGNodeConstRef node, YGNodeConstRef owner, size_t childIndex) const;
 
+  void setMeasureBatchFunc(YGMeasureBatchFunc measureBatchFunc);
+  bool hasMeasureBatchFunc() const;
+  void measureBatch(YGMeasureRequest* requests, size_t count) const;
+
+  // Subscribes to events of the given types published by nodes using this
+  // config
+  void subscribeToEvents(
+      std::function<Event::Subscriber>&& subscriber,
+      Event::TypeSet types = Event::kAllTypes);
+  void resetEventSubscribers();
+  const EventSubscribers& getEventSubscribers() const;
+
+  // Aggregates metrics of layouts using this config into `counters`, which
+  // must outlive the config or be unset first. May be shared between configs.
+  void setLayoutCounters(LayoutCounters* counters);
+  LayoutCounters* getLayoutCounters() const;
+
   static const Config& getDefault();
 
  private:
   YGCloneNodeFunc cloneNodeCallback_{nullptr};
+  YGMeasureBatchFunc measureBatchFunc_{nullptr};
   YGLogger logger_{};
 
   bool useWebDefaults_ : 1 = false;
@@ -76,6 +96,8 @@ class YG_EXPORT Config : public ::YGConfig {
   Errata errata_ = Errata::None;
   float pointScaleFactor_ = 1.0f;
   void* context_ = nullptr;
+  EventSubscribers eventSubscribers_;
+  LayoutCounters* layoutCounters_ = nullptr;
 };
 
 inline Config* resolveRef(const YGConfigRef ref) {
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <chrono>
+
+#include <yoga/event/LayoutCounters.h>
+
+namespace facebook::yoga {
+
+namespace {
+
+// Measure callbacks on a given thread do not overlap, so the start of the
+// current callback can be tracked per thread.
+thread_local std::chrono::steady_clock::time_point measureCallbackStart;
+
+void add(std::atomic<uint64_t>& counter, uint64_t value) {
+  counter.fetch_add(value, std::memory_order_relaxed);
+}
+
+} // namespace
+
+void LayoutCounters::record(
+    Event::Type eventType,
+    const Event::Data& eventData) {
+  switch (eventType) {
+    case Event::LayoutPassEnd: {
+      const auto& layoutData = *eventData.get<Event::LayoutPassEnd>().layoutData;
+      add(layoutPasses_, 1);
+      add(layouts_, static_cast<uint64_t>(layoutData.layouts));
+      add(measures_, static_cast<uint64_t>(layoutData.measures));
+      add(cachedLayouts_, static_cast<uint64_t>(layoutData.cachedLayouts));
+      add(cachedMeasures_, static_cast<uint64_t>(layoutData.cachedMeasures));
+      break;
+    }
+    case Event::MeasureCallbackStart:
+      measureCallbackStart = std::chrono::steady_clock::now();
+      break;
+    case Event::MeasureCallbackEnd:
+      add(measureCallbacks_, 1);
+      add(measureCallbackNanos_,
+          static_cast<uint64_t>(
+              std::chrono::duration_cast<std::chrono::nanoseconds>(
+                  std::chrono::steady_clock::now() - measureCallbackStart)
+                  .count()));
+      break;
+    default:
+      break;
+  }
+}
+
+LayoutCounters::Snapshot LayoutCounters::snapshot() const {
+  return Snapshot{
+      layoutPasses_.load(std::memory_order_relaxed),
+      layouts_.load(std::memory_order_relaxed),
+      measures_.load(std::memory_order_relaxed),
+      cachedLayouts_.load(std::memory_order_relaxed),
+      cachedMeasures_.load(std::memory_order_relaxed),
+      measureCallbacks_.load(std::memory_order_relaxed),
+      measureCallbackNanos_.load(std::memory_order_relaxed),
+  };
+}
+
+void LayoutCounters::reset() {
+  for (auto counter :
+       {&layoutPasses_,
+        &layouts_,
+        &measures_,
+        &cachedLayouts_,
+        &cachedMeasures_,
+        &measureCallbacks_,
+        &measureCallbackNanos_}) {
+    counter->store(0, std::memory_order_relaxed);
+  }
+}
+
+} // namespace facebook::yoga
@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+#include <yoga/Yoga.h>
+#include <yoga/event/event.h>
+
+namespace facebook::yoga {
+
+// Aggregates layout metrics from the events of one or more configs. Counters
+// are updated with relaxed atomics from whichever thread performs layout, and
+// only subscribe to once-per-pass and measure callback events, so they are
+// cheap enough to keep enabled in production.
+class YG_EXPORT LayoutCounters {
+ public:
+  struct Snapshot {
+    uint64_t layoutPasses;
+    // Nodes visited by the layout algorithm
+    uint64_t layouts;
+    uint64_t measures;
+    // Visits satisfied from the layout and measurement caches
+    uint64_t cachedLayouts;
+    uint64_t cachedMeasures;
+    uint64_t measureCallbacks;
+    uint64_t measureCallbackNanos;
+  };
+
+  static constexpr Event::TypeSet kEventTypes =
+      Event::typeSet(Event::LayoutPassEnd) |
+      Event::typeSet(Event::MeasureCallbackStart) |
+      Event::typeSet(Event::MeasureCallbackEnd);
+
+  void record(Event::Type eventType, const Event::Data& eventData);
+
+  Snapshot snapshot() const;
+
+  void reset();
+
+ private:
+  std::atomic<uint64_t> layoutPasses_{0};
+  std::atomic<uint64_t> layouts_{0};
+  std::atomic<uint64_t> measures_{0};
+  std::atomic<uint64_t> cachedLayouts_{0};
+  std::atomic<uint64_t> cachedMeasures_{0};
+  std::atomic<uint64_t> measureCallbacks_{0};
+  std::atomic<uint64_t> measureCallbackNanos_{0};
+};
+
+} // namespace facebook::yoga
@@ -5,10 +5,13 @@
  * LICENSE file in the root directory of this source tree.
  */
 
-#include "event.h"
 #include <atomic>
 #include <memory>
 
+#include <yoga/event/LayoutCounters.h>
+#include <yoga/event/event.h>
+#include <yoga/node/Node.h>
+
 namespace facebook::yoga {
 
 const char* LayoutPassReasonToString(const LayoutPassReason value) {
@@ -34,34 +37,36 @@ const char* LayoutPassReasonToString(const LayoutPassReason value) {
   }
 }
 
-namespace {
+std::atomic<Event::TypeSet> Event::activeTypes_{0};
 
-struct Node {
+struct EventSubscribers::Entry {
   std::function<Event::Subscriber> subscriber = nullptr;
-  Node* next = nullptr;
+  Event::TypeSet types = 0;
+  Entry* next = nullptr;
 
-  explicit Node(std::function<Event::Subscriber>&& subscriber)
-      : subscriber{std::move(subscriber)} {}
+  Entry(std::function<Event::Subscriber>&& subscriber, Event::TypeSet types)
+      : subscriber{std::move(subscriber)}, types{types} {}
 };
 
-std::atomic<Node*> subscribers{nullptr};
+EventSubscribers::~EventSubscribers() {
+  reset();
+}
 
-Node* push(Node* newHead) {
-  Node* oldHead = nullptr;
+void EventSubscribers::subscribe(
+    std::function<Event::Subscriber>&& subscriber,
+    Event::TypeSet types) {
+  auto newHead = new Entry{std::move(subscriber), types};
+  Entry* oldHead = nullptr;
   do {
-    oldHead = subscribers.load(std::memory_order_relaxed);
-    if (newHead != nullptr) {
-      newHead->next = oldHead;
-    }
-  } while (!subscribers.compare_exchange_weak(
+    oldHead = head_.load(std::memory_order_relaxed);
+    newHead->next = oldHead;
+  } while (!head_.compare_exchange_weak(
       oldHead, newHead, std::memory_order_release, std::memory_order_relaxed));
-  return oldHead;
+  activate(types);
 }
 
-} // namespace
-
-void Event::reset() {
-  auto head = push(nullptr);
+void EventSubscribers::reset() {
+  auto head = head_.exchange(nullptr, std::memory_order_acq_rel);
   while (head != nullptr) {
     auto current = head;
     head = head->next;
@@ -69,18 +74,51 @@ void Event::reset() {
   }
 }
 
-void Event::subscribe(std::function<Subscriber>&& subscriber) {
-  push(new Node{std::move(subscriber)});
+void EventSubscribers::publish(
+    YGNodeConstRef node,
+    Event::Type eventType,
+    Event::Data data) const {
+  for (auto entry = head_.load(std::memory_order_acquire); entry != nullptr;
+       entry = entry->next) {
+    if ((entry->types & Event::typeSet(eventType)) != 0) {
+      entry->subscriber(node, eventType, data);
+    }
+  }
+}
+
+/*static*/ void EventSubscribers::activate(Event::TypeSet types) {
+  Event::activeTypes_.fetch_or(types, std::memory_order_relaxed);
+}
+
+namespace {
+
+EventSubscribers& globalSubscribers() {
+  static EventSubscribers subscribers;
+  return subscribers;
+}
+
+} // namespace
+
+void Event::reset() {
+  globalSubscribers().reset();
+}
+
+void Event::subscribe(
+    std::function<Subscriber>&& subscriber,
+    TypeSet types) {
+  globalSubscribers().subscribe(std::move(subscriber), types);
 }
 
 void Event::publish(
     YGNodeConstRef node,
     Type eventType,
     const Data& eventData) {
-  for (auto subscriber = subscribers.load(std::memory_order_relaxed);
-       subscriber != nullptr;
-       subscriber = subscriber->next) {
-    subscriber->subscriber(node, eventType, eventData);
+  globalSubscribers().publish(node, eventType, eventData);
+
+  const auto config = resolveRef(node)->getConfig();
+  config->getEventSubscribers().publish(node, eventType, eventData);
+  if (auto counters = config->getLayoutCounters()) {
+    counters->record(eventType, eventData);
   }
 }
 
@@ -10,12 +10,23 @@
 #include <yoga/Yoga.h>
 
 #include <array>
+#include <atomic>
+#include <cstddef>
 #include <cstdint>
 #include <functional>
 #include <vector>
 
+// Bitmask of Event::Type values for which publishing is compiled in. Events of
+// other types compile to no-ops. Defaults to all events.
+#ifndef YG_ENABLED_EVENT_TYPES
+#define YG_ENABLED_EVENT_TYPES 0xFFFFFFFF
+#endif
+
 namespace facebook::yoga {
 
+class MeasureBatch;
+class ScratchArena;
+
 enum struct LayoutType : int {
   kLayout = 0,
   kMeasure = 1,
@@ -44,6 +55,20 @@ struct LayoutData {
   int measureCallbacks;
   std::array<int, static_cast<uint8_t>(LayoutPassReason::COUNT)>
       measureCallbackReasonsCount;
+  // Number of temporaries (e.g. flex lines) served by the pass's scratch arena
+  uint32_t scratchAllocations;
+  // Number of heap allocations backing the scratch arena
+  uint32_t scratchChunkAllocations;
+  size_t scratchPeakBytes;
+  // Number of measurements resolved ahead of the pass by the measure batch
+  // function, and how many of them were used in place of a measure callback
+  int measureBatchRequests;
+  int measureBatchHits;
+  // Arena for memory which does not outlive the layout pass
+  ScratchArena* scratch;
+  // Measurements resolved ahead of the pass, if the config has a measure batch
+  // function
+  const MeasureBatch* measureBatch;
 };
 
 const char* LayoutPassReasonToString(LayoutPassReason value);
@@ -64,6 +89,16 @@ struct YG_EXPORT Event {
   using Subscriber = void(YGNodeConstRef, Type, Data);
   using Subscribers = std::vector<std::function<Subscriber>>;
 
+  // Set of event types, with the bit `1 << type` set for each member
+  using TypeSet = uint32_t;
+
+  static constexpr TypeSet typeSet(Type type) {
+    return TypeSet{1} << type;
+  }
+
+  static constexpr TypeSet kAllTypes = ~TypeSet{0};
+  static constexpr TypeSet kEnabledTypes = YG_ENABLED_EVENT_TYPES;
+
   template <Type E>
   struct TypedData {};
 
@@ -80,22 +115,67 @@ struct YG_EXPORT Event {
     }
   };
 
+  // Removes all process-wide subscribers. Subscribers scoped to a config are
+  // unaffected.
   static void reset();
 
-  static void subscribe(std::function<Subscriber>&& subscriber);
+  // Subscribes to events of the given types published by any node in the
+  // process. Prefer subscribing through `Config::subscribeToEvents` to only
+  // observe nodes of a given config.
+  static void subscribe(
+      std::function<Subscriber>&& subscriber,
+      TypeSet types = kAllTypes);
 
   template <Type E>
   static void publish(YGNodeConstRef node, const TypedData<E>& eventData = {}) {
-    publish(node, E, Data{eventData});
+    if constexpr ((kEnabledTypes & typeSet(E)) != 0) {
+      // Avoid the cost of dispatch unless something may be listening
+      if ((activeTypes_.load(std::memory_order_relaxed) & typeSet(E)) != 0) {
+        publish(node, E, Data{eventData});
+      }
+    }
   }
 
  private:
+  friend class EventSubscribers;
+
+  // Union of the types subscribed to by any subscriber or sink in the process.
+  // May include types which no longer have subscribers.
+  static std::atomic<TypeSet> activeTypes_;
+
   static void publish(
       YGNodeConstRef /*node*/,
       Type /*eventType*/,
       const Data& /*eventData*/);
 };
 
+// Lock-free list of subscribers to Yoga events. Subscribers are only removed
+// all at once, on reset or destruction.
+class YG_EXPORT EventSubscribers {
+ public:
+  EventSubscribers() = default;
+  EventSubscribers(const EventSubscribers&) = delete;
+  EventSubscribers& operator=(const EventSubscribers&) = delete;
+  ~EventSubscribers();
+
+  void subscribe(
+      std::function<Event::Subscriber>&& subscriber,
+      Event::TypeSet types);
+
+  void reset();
+
+  void publish(YGNodeConstRef node, Event::Type eventType, Event::Data data)
+      const;
+
+  // Marks events of the given types as having a listener, so they are
+  // dispatched when published
+  static void activate(Event::TypeSet types);
+
+ private:
+  struct Entry;
+  std::atomic<Entry*> head_{nullptr};
+};
+
 template <>
 struct Event::TypedData<Event::NodeAllocation> {
   YGConfigConstRef config;
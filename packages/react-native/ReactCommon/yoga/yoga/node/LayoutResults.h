@@ -33,8 +33,6 @@ struct LayoutResults {
   Direction lastOwnerDirection = Direction::Inherit;
 
   uint32_t nextCachedMeasurementsIndex = 0;
-  std::array<CachedMeasurement, MaxCachedMeasurements> cachedMeasurements = {};
-
   CachedMeasurement cachedLayout{};
 
   Direction direction() const {
@@ -116,6 +114,12 @@ struct LayoutResults {
   std::array<float, 4> margin_ = {};
   std::array<float, 4> border_ = {};
   std::array<float, 4> padding_ = {};
+
+ public:
+  // The measurement cache is only consulted when a node is measured under new
+  // constraints, so it is kept after the fields read on every visit, to avoid
+  // spreading them across cache lines.
+  std::array<CachedMeasurement, MaxCachedMeasurements> cachedMeasurements = {};
 };
 
 } // namespace facebook::yoga
@@ -36,13 +36,13 @@ Node::Node(Node&& node) noexcept
       measureFunc_(node.measureFunc_),
       baselineFunc_(node.baselineFunc_),
       dirtiedFunc_(node.dirtiedFunc_),
-      style_(std::move(node.style_)),
-      layout_(node.layout_),
       lineIndex_(node.lineIndex_),
       owner_(node.owner_),
       children_(std::move(node.children_)),
       config_(node.config_),
-      resolvedDimensions_(node.resolvedDimensions_) {
+      resolvedDimensions_(node.resolvedDimensions_),
+      style_(std::move(node.style_)),
+      layout_(node.layout_) {
   for (auto c : children_) {
     c->setOwner(this);
   }
@@ -269,6 +269,8 @@ class YG_EXPORT Node : public ::YGNode {
     style_.setAlignContent(Align::Stretch);
   }
 
+  // Members are ordered so that the fields read when visiting a node during
+  // layout are contiguous, ending with the cold measurement cache of layout_.
   bool hasNewLayout_ : 1 = true;
   bool isReferenceBaseline_ : 1 = false;
   bool isDirty_ : 1 = false;
@@ -278,14 +280,14 @@ class YG_EXPORT Node : public ::YGNode {
   YGMeasureFunc measureFunc_ = nullptr;
   YGBaselineFunc baselineFunc_ = nullptr;
   YGDirtiedFunc dirtiedFunc_ = nullptr;
-  Style style_;
-  LayoutResults layout_;
   size_t lineIndex_ = 0;
   Node* owner_ = nullptr;
   std::vector<Node*> children_;
   const Config* config_;
   std::array<Style::Length, 2> resolvedDimensions_{
       {value::undefined(), value::undefined()}};
+  Style style_;
+  LayoutResults layout_;
 };
 
 inline Node* resolveRef(const YGNodeRef ref) {